@@ -0,0 +1,147 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_PARSED_NAME_HPP
+#define CTNP_PARSED_NAME_HPP
+
+#pragma once
+
+#include "ctnp/Prettify.hpp"
+#include "ctnp/PrintVisitor.hpp"
+#include "ctnp/config/Config.hpp"
+#include "ctnp/parsing/NodeTable.hpp"
+#include "ctnp/parsing/Parser.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ctnp
+{
+    /**
+     * \brief Owning parse-result of a single name, which can be visited any number of times.
+     * \details The name is parsed exactly once, during construction. Afterwards, each `accept` call just replays the
+     * recorded node-table into the given visitor, thus neither lexing nor parsing is repeated.
+     *
+     * The source text is owned in a heap-buffer, which never moves. Thus, moving a `ParsedName` keeps all recorded
+     * contents valid.
+     * \note The cached renderings are created lazily, thus a single instance must not be used by multiple threads
+     * concurrently.
+     */
+    class ParsedName
+    {
+    public:
+        /**
+         * \brief Parses the given type name.
+         * \details All intermediate allocations are drawn from the given resource, or from an internal arena, if no
+         * resource is given. The result itself does not depend on that resource.
+         */
+        [[nodiscard]]
+        static ParsedName parse_type(std::string_view const name, std::pmr::memory_resource* const resource = nullptr)
+        {
+            ParsedName result{name};
+            parsing::detail::ParserImpl parser{result.source(), resource};
+            result.m_Nodes = parser.parse_type_table();
+
+            return result;
+        }
+
+        /**
+         * \brief Parses the given function name.
+         * \copydetails parse_type
+         */
+        [[nodiscard]]
+        static ParsedName parse_function(std::string_view const name, std::pmr::memory_resource* const resource = nullptr)
+        {
+            ParsedName result{name};
+            parsing::detail::ParserImpl parser{detail::remove_template_details(result.source()), resource};
+            result.m_Nodes = parser.parse_function_table();
+
+            return result;
+        }
+
+        ~ParsedName() = default;
+
+        ParsedName(ParsedName const&) = delete;
+        ParsedName& operator=(ParsedName const&) = delete;
+
+        [[nodiscard]]
+        ParsedName(ParsedName&&) = default;
+        ParsedName& operator=(ParsedName&&) = default;
+
+        /**
+         * \brief Returns the full name, as it has been given.
+         */
+        [[nodiscard]]
+        std::string_view source() const noexcept
+        {
+            return std::string_view{m_Source.get(), m_SourceLength};
+        }
+
+        /**
+         * \brief Determines, whether the name has been recognized.
+         * \details Unrecognized names are reported as a single `unrecognized` callback.
+         */
+        [[nodiscard]]
+        bool is_recognized() const noexcept
+        {
+            return m_Nodes.empty()
+                || parsing::Node::unrecognized != m_Nodes[0u].kind;
+        }
+
+        [[nodiscard]]
+        parsing::NodeTable const& nodes() const noexcept
+        {
+            return m_Nodes;
+        }
+
+        /**
+         * \brief Drives the given visitor, exactly as if the name had been parsed again.
+         */
+        template <parsing::parser_visitor Visitor>
+        void accept(Visitor& visitor) const
+        {
+            m_Nodes.replay(visitor);
+        }
+
+        /**
+         * \brief Returns the prettified name, which is rendered on first request.
+         * \see PrintVisitor
+         */
+        [[nodiscard]]
+        std::string const& pretty() const
+        {
+            if (!m_Pretty)
+            {
+                std::string& pretty = m_Pretty.emplace();
+                PrintVisitor visitor{std::back_inserter(pretty)};
+                accept(visitor);
+            }
+
+            return *m_Pretty;
+        }
+
+    private:
+        std::unique_ptr<char[]> m_Source;
+        std::size_t m_SourceLength;
+        parsing::NodeTable m_Nodes{};
+        mutable std::optional<std::string> m_Pretty{};
+
+        [[nodiscard]]
+        explicit ParsedName(std::string_view const name)
+            : m_Source{std::make_unique<char[]>(name.size())},
+              m_SourceLength{name.size()}
+        {
+            std::ranges::copy(name, m_Source.get());
+        }
+    };
+}
+
+#endif
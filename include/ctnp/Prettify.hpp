@@ -13,56 +13,208 @@
 #include "ctnp/lexing/Lexer.hpp"
 #include "ctnp/parsing/Parser.hpp"
 
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+
 namespace ctnp
 {
     namespace detail
     {
+        /**
+         * \brief Removes trailing template details (e.g. `[with T = int]` or `[T = int]`) from the given name.
+         * \details Trailing array extents (e.g. `int[3]` or `int (&)[3]`) are kept, as they never contain an `=`.
+         */
         [[nodiscard]]
         constexpr std::string_view remove_template_details(std::string_view name) noexcept
         {
-            if (name.ends_with(']'))
+            if (!name.ends_with(']'))
             {
-                auto rest = name | std::views::reverse | std::views::drop(1);
-                if (auto const openingIter = std::ranges::find(rest, '[');
-                    openingIter != rest.end())
+                return name;
+            }
+
+            // The details may contain array extents on their own, thus the matching bracket must be found.
+            std::size_t depth{};
+            std::size_t opening = name.size();
+            while (0u != opening)
+            {
+                --opening;
+                if (']' == name[opening])
+                {
+                    ++depth;
+                }
+                else if ('[' == name[opening]
+                         && 0u == --depth)
                 {
-                    auto const end = std::ranges::find_if_not(
-                        openingIter + 1,
-                        rest.end(),
-                        lexing::is_space);
-                    name = std::string_view{name.cbegin(), end.base()};
+                    break;
                 }
             }
 
+            if (0u != depth
+                || std::string_view::npos == name.find('=', opening))
+            {
+                return name;
+            }
+
+            name.remove_suffix(name.size() - opening);
+            while (!name.empty()
+                   && lexing::is_space(name.back()))
+            {
+                name.remove_suffix(1u);
+            }
+
             return name;
         }
     }
 
+    /**
+     * \brief Prettifies the given type name.
+     * \details All intermediate allocations are drawn from the given resource, or from an internal arena, if no
+     * resource is given.
+     */
     template <print_iterator OutIter>
-    constexpr OutIter prettify_type(OutIter out, std::string_view name)
+    constexpr OutIter prettify_type(OutIter out, std::string_view name, std::pmr::memory_resource* const resource = nullptr)
     {
         static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
 
         PrintVisitor<OutIter> visitor{std::move(out)};
-        parsing::Parser parser{std::ref(visitor), name};
+        parsing::Parser parser{std::ref(visitor), name, resource};
         parser.parse_type();
 
         return visitor.out();
     }
 
+    /**
+     * \brief Prettifies the given NUL-terminated type name, e.g. the result of `typeid(T).name()`.
+     * \details The name is consumed in a single pass, as its terminator is used as end-of-input sentinel.
+     */
     template <print_iterator OutIter>
-    constexpr OutIter prettify_function(OutIter out, std::string_view name)
+    constexpr OutIter prettify_type(OutIter out, char const* const name, std::pmr::memory_resource* const resource = nullptr)
+    {
+        static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
+
+        PrintVisitor<OutIter> visitor{std::move(out)};
+        parsing::Parser parser{std::ref(visitor), name, resource};
+        parser.parse_type();
+
+        return visitor.out();
+    }
+
+    /**
+     * \brief Prettifies the given function name.
+     * \details All intermediate allocations are drawn from the given resource, or from an internal arena, if no
+     * resource is given.
+     */
+    template <print_iterator OutIter>
+    constexpr OutIter prettify_function(OutIter out, std::string_view name, std::pmr::memory_resource* const resource = nullptr)
     {
         name = detail::remove_template_details(name);
 
         static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
 
         PrintVisitor<OutIter> visitor{std::move(out)};
-        parsing::Parser parser{std::ref(visitor), name};
+        parsing::Parser parser{std::ref(visitor), name, resource};
         parser.parse_function();
 
         return visitor.out();
     }
+
+    /**
+     * \brief Result of `prettify`.
+     */
+    template <print_iterator OutIter>
+    struct PrettifyResult
+    {
+        OutIter out;
+        parsing::NameKind kind;
+    };
+
+    /**
+     * \brief Prettifies the given name, which may either denote a type or a function.
+     * \details The kind of the name is detected in a single pass; thus there is no need to try `prettify_type` and
+     * `prettify_function` one after another. As for functions, trailing template details (e.g. `[with T = int]`) are
+     * removed.
+     */
+    template <print_iterator OutIter>
+    constexpr PrettifyResult<OutIter> prettify(OutIter out, std::string_view name, std::pmr::memory_resource* const resource = nullptr)
+    {
+        name = detail::remove_template_details(name);
+
+        static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
+
+        PrintVisitor<OutIter> visitor{std::move(out)};
+        parsing::Parser parser{std::ref(visitor), name, resource};
+        parsing::NameKind const kind = parser.parse_auto();
+
+        return PrettifyResult<OutIter>{.out = visitor.out(), .kind = kind};
+    }
+
+    /**
+     * \brief Prettifies the given type name by the given session.
+     * \details The session keeps its capacity, thus repeated calls do not allocate, once the session is warmed up.
+     */
+    template <print_iterator OutIter>
+    OutIter prettify_type(parsing::ParserSession& session, OutIter out, std::string_view const name)
+    {
+        static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
+
+        PrintVisitor<OutIter> visitor{std::move(out)};
+        session.reset(name);
+        session.parse_type(visitor);
+
+        return visitor.out();
+    }
+
+    /**
+     * \brief Prettifies the given NUL-terminated type name by the given session.
+     */
+    template <print_iterator OutIter>
+    OutIter prettify_type(parsing::ParserSession& session, OutIter out, char const* const name)
+    {
+        static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
+
+        PrintVisitor<OutIter> visitor{std::move(out)};
+        session.reset(name);
+        session.parse_type(visitor);
+
+        return visitor.out();
+    }
+
+    /**
+     * \brief Prettifies the given function name by the given session.
+     * \details The session keeps its capacity, thus repeated calls do not allocate, once the session is warmed up.
+     */
+    template <print_iterator OutIter>
+    OutIter prettify_function(parsing::ParserSession& session, OutIter out, std::string_view name)
+    {
+        name = detail::remove_template_details(name);
+
+        static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
+
+        PrintVisitor<OutIter> visitor{std::move(out)};
+        session.reset(name);
+        session.parse_function(visitor);
+
+        return visitor.out();
+    }
+
+    /**
+     * \brief Prettifies the given name, which may either denote a type or a function, by the given session.
+     * \copydetails prettify(OutIter, std::string_view, std::pmr::memory_resource*)
+     */
+    template <print_iterator OutIter>
+    PrettifyResult<OutIter> prettify(parsing::ParserSession& session, OutIter out, std::string_view name)
+    {
+        name = detail::remove_template_details(name);
+
+        static_assert(parsing::parser_visitor<PrintVisitor<OutIter>>);
+
+        PrintVisitor<OutIter> visitor{std::move(out)};
+        session.reset(name);
+        parsing::NameKind const kind = session.parse_auto(visitor);
+
+        return PrettifyResult<OutIter>{.out = visitor.out(), .kind = kind};
+    }
 }
 
 #endif
@@ -12,6 +12,7 @@
 #include "ctnp/lexing/Lexer.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <ranges>
 #include <string_view>
@@ -52,6 +53,9 @@ namespace ctnp
     class PrintVisitor
     {
     public:
+        // The content of template-args is never printed, thus it doesn't have to be parsed at all.
+        static constexpr bool needsTemplateArgs{false};
+
         [[nodiscard]]
         explicit PrintVisitor(OutIter out) noexcept(std::is_nothrow_move_constructible_v<OutIter>)
             : m_Out{std::move(out)}
@@ -100,10 +104,21 @@ namespace ctnp
             }
         }
 
-        constexpr void add_identifier(std::string_view content)
+        constexpr void add_identifier(std::string_view const content)
         {
-            if (content.starts_with("{lambda(")
-                && content.ends_with('}'))
+            add_identifier(content, lexing::token::Identifier::classify(content));
+        }
+
+        /**
+         * \brief Prints the identifier, whose flags have already been determined.
+         * \see lexing::token::Identifier::Flag
+         */
+        constexpr void add_identifier(std::string_view content, std::uint8_t const flags)
+        {
+            using Flag = lexing::token::Identifier::Flag;
+            CTNP_ASSERT(flags == (lexing::token::Identifier::classify(content) | (flags & Flag::builtin)), "Flags do not match the content.");
+
+            if (flags & Flag::braceLambda)
             {
                 auto const closingIter = std::ranges::find(content | std::views::reverse, ')');
                 print_identifier("lambda");
@@ -113,9 +128,7 @@ namespace ctnp
             }
 
             // Lambdas can have the form `'lambda\\d*'`. Just print everything between ''.
-            if (constexpr std::string_view lambdaPrefix{"'lambda"};
-                content.starts_with(lambdaPrefix)
-                && content.ends_with('\''))
+            if (flags & Flag::quotedLambda)
             {
                 print_identifier(content.substr(1u, content.size() - 2u));
 
@@ -123,10 +136,9 @@ namespace ctnp
             }
 
             // Msvc yields lambdas in form of `<lambda_\d+>`
-            if (constexpr std::string_view lambdaPrefix{"<lambda_"};
-                content.starts_with(lambdaPrefix)
-                && content.ends_with('>'))
+            if (flags & Flag::msvcLambda)
             {
+                constexpr std::string_view lambdaPrefix{"<lambda_"};
                 print_identifier("lambda");
 
                 auto const numberBegin = content.cbegin() + lambdaPrefix.size();
@@ -141,10 +153,9 @@ namespace ctnp
             }
 
             // gcc source-location yields lambdas in form of `<lambda(args)>`
-            if (std::string_view constexpr lambdaPrefix{"<lambda("};
-                content.starts_with(lambdaPrefix)
-                && content.ends_with(")>"))
+            if (flags & Flag::angleLambda)
             {
+                std::string_view constexpr lambdaPrefix{"<lambda("};
                 print_identifier("lambda");
 
                 // Todo: There may be a full argument-list, which we should actually parse.
@@ -154,11 +165,10 @@ namespace ctnp
                 return;
             }
 
-            if (content.starts_with('`')
-                && content.ends_with('\''))
+            if (flags & Flag::backtickQuoted)
             {
                 // msvc injects `\d+' as auxiliar namespaces. Ignore them.
-                if (std::ranges::all_of(content.substr(1u, content.size() - 2u), lexing::is_digit))
+                if (flags & Flag::msvcAuxiliary)
                 {
                     m_IgnoreNextScopeResolution = true;
 
@@ -168,7 +178,9 @@ namespace ctnp
                 content = content.substr(1u, content.size() - 2u);
             }
 
-            if (ignored_identifiers().contains(content))
+            // All ignored identifiers are reserved ones.
+            if ((flags & (Flag::reserved | Flag::backtickQuoted))
+                && ignored_identifiers().contains(content))
             {
                 m_IgnoreNextScopeResolution = true;
 
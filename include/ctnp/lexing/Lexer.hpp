@@ -8,39 +8,302 @@
 
 #pragma once
 
+#include "ctnp/lexing/TokenBuffer.hpp"
 #include "ctnp/lexing/Tokens.hpp"
 
-#include <cctype>
-#include <span>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <string_view>
 #include <utility>
+#include <variant>
+
+namespace ctnp::lexing::detail
+{
+    /**
+     * \brief Bit-flags, describing the lexical properties of a single character.
+     */
+    enum CharClass : std::uint8_t
+    {
+        none = 0u,
+        // see: https://en.cppreference.com/w/cpp/string/byte/isspace
+        space = 1u << 0u,
+        // see: https://en.cppreference.com/w/cpp/string/byte/isdigit
+        digit = 1u << 1u,
+        // The character is the first character of at least one operator or punctuator.
+        opOrPunctuatorPrefix = 1u << 2u,
+        // The character is on its own a complete operator or punctuator.
+        opOrPunctuator = 1u << 3u,
+        // The character is a non-printable control character, which is not a space.
+        // Such characters can never be part of a valid name.
+        control = 1u << 4u
+    };
+
+    /**
+     * \brief Generates the classification for every possible character value.
+     * \details The operator and punctuator flags are derived from `make_operator_or_punctuator_collection`, so that
+     * the table can never get out of sync with the actual token texts.
+     * The space and digit flags follow the classification of the "C" locale.
+     */
+    [[nodiscard]]
+    consteval auto make_char_class_table() noexcept
+    {
+        std::array<std::uint8_t, 256u> table{};
+
+        for (char const c : std::string_view{" \t\n\v\f\r"})
+        {
+            table[static_cast<unsigned char>(c)] |= space;
+        }
+
+        for (char c = '0'; c <= '9'; ++c)
+        {
+            table[static_cast<unsigned char>(c)] |= digit;
+        }
+
+        for (std::size_t c = 0u; c < 0x20u; ++c)
+        {
+            if (0u == (table[c] & space))
+            {
+                table[c] |= control;
+            }
+        }
+        table[0x7Fu] |= control;
+
+        for (std::string_view const text : make_operator_or_punctuator_collection())
+        {
+            CTNP_ASSERT(!text.empty(), "Empty operator or punctuator detected.");
+
+            auto& entry = table[static_cast<unsigned char>(text.front())];
+            entry |= opOrPunctuatorPrefix;
+            if (1u == text.size())
+            {
+                entry |= opOrPunctuator;
+            }
+        }
+
+        return table;
+    }
+
+    inline constexpr std::array charClassTable = make_char_class_table();
+
+    [[nodiscard]]
+    constexpr bool has_char_class(char const c, std::uint8_t const mask) noexcept
+    {
+        return 0u != (charClassTable[static_cast<unsigned char>(c)] & mask);
+    }
+}
+
+namespace ctnp::lexing::detail
+{
+    /**
+     * \brief Deterministic finite automaton, which performs the longest-match recognition of operators and punctuators.
+     * \details Each state corresponds to a prefix of at least one operator or punctuator.
+     * To keep the transition table small, characters are mapped onto equivalence classes first, where class `0`
+     * denotes all characters, which do not appear in any operator or punctuator.
+     * \tparam stateCount The number of states (including the dead and the start state).
+     * \tparam classCount The number of character classes.
+     */
+    template <std::size_t stateCount, std::size_t classCount>
+    struct OpOrPunctuatorDfa
+    {
+        static constexpr std::uint8_t deadState{0u};
+        static constexpr std::uint8_t startState{1u};
+
+        std::array<std::uint8_t, 256u> charClasses{};
+        std::array<std::array<std::uint8_t, classCount>, stateCount> transitions{};
+        // The index of the operator or punctuator, which is recognized in that state, or `-1`.
+        std::array<std::int8_t, stateCount> accepts{};
+
+        struct Match
+        {
+            std::size_t length{};
+            std::ptrdiff_t index{-1};
+        };
+
+        /**
+         * \brief Determines the longest operator or punctuator, which is a prefix of the given text.
+         * \return The length and the index of the match. If no match exists, the length is `0` and the index is `-1`.
+         */
+        [[nodiscard]]
+        constexpr Match longest_match(std::string_view const text) const noexcept
+        {
+            return longest_match_impl(text.data(), text.size());
+        }
+
+        /**
+         * \brief Determines the longest operator or punctuator at the beginning of the given NUL-terminated text.
+         * \details The terminator never continues a match, thus the text is never read beyond it.
+         */
+        [[nodiscard]]
+        constexpr Match longest_match(char const* const text) const noexcept
+        {
+            CTNP_ASSERT(text, "Text must not be null.");
+
+            return longest_match_impl(text, std::numeric_limits<std::size_t>::max());
+        }
+
+    private:
+        [[nodiscard]]
+        constexpr Match longest_match_impl(char const* const text, std::size_t const maxLength) const noexcept
+        {
+            Match match{};
+            std::uint8_t state{startState};
+            for (std::size_t i{}; i < maxLength; ++i)
+            {
+                state = transitions[state][charClasses[static_cast<unsigned char>(text[i])]];
+                if (deadState == state)
+                {
+                    break;
+                }
+
+                if (std::int8_t const index = accepts[state];
+                    0 <= index)
+                {
+                    match = Match{.length = i + 1u, .index = index};
+                }
+            }
+
+            return match;
+        }
+    };
+
+    [[nodiscard]]
+    consteval std::size_t count_op_or_punctuator_dfa_states() noexcept
+    {
+        // As the collection is sorted, all texts sharing a prefix are adjacent.
+        // Thus, every character, which is not shared with the predecessor, introduces a new state.
+        std::size_t count{2u};
+        std::string_view prev{};
+        for (std::string_view const text : make_operator_or_punctuator_collection())
+        {
+            auto const commonLength = std::ranges::distance(
+                text.cbegin(),
+                std::ranges::mismatch(text, prev).in1);
+            count += text.size() - static_cast<std::size_t>(commonLength);
+            prev = text;
+        }
+
+        return count;
+    }
+
+    [[nodiscard]]
+    consteval std::size_t count_op_or_punctuator_dfa_classes() noexcept
+    {
+        std::array<bool, 256u> isUsed{};
+        for (std::string_view const text : make_operator_or_punctuator_collection())
+        {
+            for (char const c : text)
+            {
+                isUsed[static_cast<unsigned char>(c)] = true;
+            }
+        }
+
+        return 1u + static_cast<std::size_t>(std::ranges::count(isUsed, true));
+    }
+
+    [[nodiscard]]
+    consteval auto make_op_or_punctuator_dfa() noexcept
+    {
+        constexpr std::size_t stateCount = count_op_or_punctuator_dfa_states();
+        constexpr std::size_t classCount = count_op_or_punctuator_dfa_classes();
+        static_assert(stateCount <= 128u, "Too many states for the state type.");
+
+        using Dfa = OpOrPunctuatorDfa<stateCount, classCount>;
+        Dfa dfa{};
+        std::ranges::fill(dfa.accepts, std::int8_t{-1});
+
+        std::uint8_t nextClass{1u};
+        std::uint8_t nextState{Dfa::startState + 1u};
+        auto const collection = make_operator_or_punctuator_collection();
+        for (std::size_t index{}; index < collection.size(); ++index)
+        {
+            std::uint8_t state{Dfa::startState};
+            for (char const c : collection[index])
+            {
+                auto& charClass = dfa.charClasses[static_cast<unsigned char>(c)];
+                if (0u == charClass)
+                {
+                    charClass = nextClass++;
+                }
+
+                auto& target = dfa.transitions[state][charClass];
+                if (Dfa::deadState == target)
+                {
+                    target = nextState++;
+                }
+
+                state = target;
+            }
+
+            dfa.accepts[state] = static_cast<std::int8_t>(index);
+        }
+
+        CTNP_ASSERT(classCount == nextClass, "Class count mismatch.");
+        CTNP_ASSERT(stateCount == nextState, "State count mismatch.");
+
+        return dfa;
+    }
+
+    inline constexpr auto opOrPunctuatorDfa = make_op_or_punctuator_dfa();
+}
 
 namespace ctnp::lexing
 {
     // see: https://en.cppreference.com/w/cpp/string/byte/isspace
+    // Other than `std::isspace`, this is independent of the current locale.
     constexpr auto is_space = [](char const c) noexcept {
-        return static_cast<bool>(
-            std::isspace(static_cast<unsigned char>(c)));
+        return detail::has_char_class(c, detail::space);
     };
 
     // see: https://en.cppreference.com/w/cpp/string/byte/isdigit
     constexpr auto is_digit = [](char const c) noexcept {
-        return static_cast<bool>(
-            std::isdigit(static_cast<unsigned char>(c)));
+        return detail::has_char_class(c, detail::digit);
     };
 
+    // see: https://en.cppreference.com/w/cpp/string/byte/iscntrl
+    // Other than `std::iscntrl`, spaces (like `\t` or `\n`) are not considered as control characters.
+    constexpr auto is_control = [](char const c) noexcept {
+        return detail::has_char_class(c, detail::control);
+    };
+
+    /**
+     * \brief Splits a name into its tokens.
+     * \details The lexer is fully usable during constant evaluation, so names which are known at compile time
+     * (e.g. from `std::source_location::function_name()`) can be tokenized without any runtime cost.
+     * \see tokenize_packed
+     */
     class Lexer
     {
     public:
         [[nodiscard]]
-        explicit Lexer(std::string_view text) noexcept
-            : m_Text{std::move(text)},
+        explicit constexpr Lexer(std::string_view const text) noexcept
+            : m_Begin{text.data()},
+              m_Cursor{text.data()},
+              m_End{text.data() + text.size()},
               m_Next{find_next()}
         {
         }
 
+        /**
+         * \brief Lexes the given NUL-terminated text.
+         * \details The terminator is used as end-of-input sentinel, thus the text is consumed in a single pass, without
+         * determining its length beforehand.
+         * The produced tokens (including the final end-token) are identical to those of a lexer, which is constructed
+         * from `std::string_view{text}`.
+         */
         [[nodiscard]]
-        Token next() noexcept
+        explicit constexpr Lexer(char const* const text) noexcept
+            : m_Begin{require_text(text)},
+              m_Cursor{text},
+              m_Next{find_next()}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr Token next() noexcept
         {
             return std::exchange(m_Next, find_next());
         }
@@ -51,22 +314,220 @@ namespace ctnp::lexing
             return m_Next;
         }
 
+        /**
+         * \brief Returns the source text.
+         * \details For NUL-terminated texts, the end is not known in advance. In this case, the returned text ends
+         * after the peeked token.
+         */
+        [[nodiscard]]
+        constexpr std::string_view source() const noexcept
+        {
+            return std::string_view{m_Begin, m_End ? m_End : m_Cursor};
+        }
+
+        /**
+         * \brief Determines, whether any of the lexed tokens (including the peeked one) contains a control character.
+         * \details Such characters can never be part of a valid name. They are always lexed as part of an identifier.
+         */
+        [[nodiscard]]
+        constexpr bool has_control() const noexcept
+        {
+            return m_HasControl;
+        }
+
+        /**
+         * \brief Lexes all remaining tokens at once and appends them to the given buffer.
+         * \details The buffer is reset to the source of this lexer beforehand. The final end-token is always appended,
+         * so the buffer can directly be consumed via a `TokenCursor`.
+         * \note The lexer is exhausted afterwards.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void tokenize_all(TokenBuffer& buffer)
+        {
+            buffer.reset(source());
+
+            for (;;)
+            {
+                Token const token = next();
+                // The end of NUL-terminated texts is discovered step by step.
+                buffer.extend_source(source());
+                buffer.push_back(token);
+
+                if (std::holds_alternative<token::End>(token.classification))
+                {
+                    break;
+                }
+            }
+
+            if (m_HasControl)
+            {
+                buffer.mark_control();
+            }
+        }
+
+        /**
+         * \brief Lexes all remaining tokens at once and appends them to the given buffer, which keeps its tokens.
+         * \details This resumes lexing of a source, whose leading tokens are already known. Thus, the text of this
+         * lexer must be the rest of the source of the buffer, right behind the last token.
+         * \note The lexer is exhausted afterwards.
+         * \see TokenBuffer::stable_prefix
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void tokenize_remaining(TokenBuffer& buffer)
+        {
+            CTNP_ASSERT(m_End, "NUL-terminated texts are not supported.");
+            CTNP_ASSERT(m_End == buffer.source().data() + buffer.source().size(), "Text must be the rest of the source.");
+
+            for (;;)
+            {
+                Token const token = next();
+                buffer.push_back(token);
+
+                if (std::holds_alternative<token::End>(token.classification))
+                {
+                    break;
+                }
+            }
+
+            if (m_HasControl)
+            {
+                buffer.mark_control();
+            }
+        }
+
     private:
-        std::string_view m_Text;
+        char const* m_Begin;
+        char const* m_Cursor;
+        // Is null, when the text is NUL-terminated.
+        char const* m_End{nullptr};
+        bool m_HasControl{false};
         Token m_Next;
 
+        // The first token is already lexed during the member initialization, thus the check must happen before.
+        [[nodiscard]]
+        static constexpr char const* require_text(char const* const text) noexcept
+        {
+            CTNP_ASSERT(text, "Text must not be null.");
+
+            return text;
+        }
+
         [[nodiscard]]
-        Token find_next() noexcept;
+        constexpr bool is_end(char const* const position) const noexcept
+        {
+            return m_End
+                     ? position == m_End
+                     : '\0' == *position;
+        }
 
         [[nodiscard]]
-        constexpr std::string_view next_as_space() noexcept;
+        constexpr bool is_end() const noexcept
+        {
+            return is_end(m_Cursor);
+        }
+
+        /**
+         * \brief Finds the first character in `[first, end)`, which does not satisfy the predicate.
+         * \details For NUL-terminated texts, the terminator acts as sentinel.
+         */
+        template <typename Predicate>
+        [[nodiscard]]
+        constexpr char const* find_if_not(char const* first, Predicate predicate) const noexcept
+        {
+            if (m_End)
+            {
+                return std::ranges::find_if_not(first, m_End, predicate);
+            }
+
+            while ('\0' != *first && std::invoke(predicate, *first))
+            {
+                ++first;
+            }
+
+            return first;
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view consume_until(char const* const last) noexcept
+        {
+            std::string_view const content{m_Cursor, last};
+            m_Cursor = last;
+
+            return content;
+        }
+
+        [[nodiscard]]
+        constexpr Token find_next() noexcept
+        {
+            if (is_end())
+            {
+                return Token{
+                    .content = {m_Cursor, m_Cursor},
+                    .classification = token::End{}
+                };
+            }
+
+            if (is_space(*m_Cursor))
+            {
+                // Multiple consecutive spaces or any whitespace character other than a single space
+                // carry no meaningful semantic value beyond delimitation.
+                // Although single spaces may sometimes influence the result and sometimes not,
+                // complicating the overall process, we filter out all non-single whitespace characters here.
+                if (std::string_view const content = next_as_space();
+                    " " == content)
+                {
+                    return Token{
+                        .content = content,
+                        .classification = token::Space{}};
+                }
+
+                return find_next();
+            }
+
+            if (detail::has_char_class(*m_Cursor, detail::opOrPunctuatorPrefix))
+            {
+                return next_as_op_or_punctuator();
+            }
+
+            std::string_view const content = next_as_identifier();
+            // As we do not perform any prefix-checks, we need to check now whether the token actually denotes a keyword.
+            if (std::ptrdiff_t const keywordIndex = token::Keyword::find(content);
+                0 <= keywordIndex)
+            {
+                return Token{
+                    .content = content,
+                    .classification = token::Keyword{keywordIndex}};
+            }
+
+            return Token{
+                .content = content,
+                .classification = token::Identifier{
+                    .content = content,
+                    .flags = token::Identifier::classify(content)}};
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view next_as_space() noexcept
+        {
+            char const* const last = find_if_not(m_Cursor + 1, is_space);
+
+            return consume_until(last);
+        }
 
         /**
          * \brief Extracts the next operator or punctuator.
-         * \details Performs longest-prefix matching.
+         * \details Performs longest-prefix matching via `detail::opOrPunctuatorDfa`.
          */
         [[nodiscard]]
-        constexpr Token next_as_op_or_punctuator(std::span<std::string_view const> options) noexcept;
+        constexpr Token next_as_op_or_punctuator() noexcept
+        {
+            auto const [length, index] = m_End
+                                           ? detail::opOrPunctuatorDfa.longest_match(std::string_view{m_Cursor, m_End})
+                                           : detail::opOrPunctuatorDfa.longest_match(m_Cursor);
+            CTNP_ASSERT(0u < length && 0 <= index, "Assumption does not hold.");
+
+            return Token{
+                .content = consume_until(m_Cursor + length),
+                .classification = token::OperatorOrPunctuator{index}};
+        }
 
         /**
          * \brief Extracts the next identifier.
@@ -77,10 +538,68 @@ namespace ctnp::lexing
          *
          * As we make the assumption that the underlying name is actually correct, we do not need to check for validity
          * here. Just treat everything else as identifier and let the parser do the rest.
+         * The only exception are control characters, which interrupt the scan, so that they are recorded without
+         * inspecting the text a second time.
          */
         [[nodiscard]]
-        constexpr std::string_view next_as_identifier() noexcept;
+        constexpr std::string_view next_as_identifier() noexcept
+        {
+            char const* last = m_Cursor;
+            do
+            {
+                m_HasControl = m_HasControl || is_control(*last);
+                last = find_if_not(
+                    last + 1,
+                    [](char const c) noexcept {
+                        return !detail::has_char_class(c, detail::space | detail::opOrPunctuator | detail::control);
+                    });
+            }
+            while (!is_end(last) && is_control(*last));
+
+            return consume_until(last);
+        }
     };
+
+    /**
+     * \brief Determines the number of tokens of the given text, including the final end-token.
+     */
+    [[nodiscard]]
+    constexpr std::size_t token_count(std::string_view const text) noexcept
+    {
+        std::size_t count{1u};
+        for (Lexer lexer{text};
+             !std::holds_alternative<token::End>(lexer.next().classification);)
+        {
+            ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * \brief Tokenizes the given text into an array of packed tokens, terminated by an end-token.
+     * \details This is mainly intended for constant evaluation, where the result may be stored in a `constexpr`
+     * variable:
+     * \code{.cpp}
+     * constexpr std::string_view name = std::source_location::current().function_name();
+     * constexpr auto tokens = lexing::tokenize_packed<lexing::token_count(name)>(name);
+     * \endcode
+     * \tparam count The number of tokens; must equal `token_count(text)`.
+     */
+    template <std::size_t count>
+    [[nodiscard]]
+    constexpr std::array<PackedToken, count> tokenize_packed(std::string_view const text) noexcept
+    {
+        std::array<PackedToken, count> tokens{};
+        Lexer lexer{text};
+        for (PackedToken& token : tokens)
+        {
+            token = PackedToken::pack(lexer.next(), text);
+        }
+        CTNP_ASSERT(std::holds_alternative<token::End>(tokens.back().unpack(text).classification), "Count mismatch.");
+
+        return tokens;
+    }
 }
 
 #endif
@@ -0,0 +1,499 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_LEXING_TOKEN_BUFFER_HPP
+#define CTNP_LEXING_TOKEN_BUFFER_HPP
+
+#pragma once
+
+#include "ctnp/config/Config.hpp"
+#include "ctnp/lexing/Tokens.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ctnp::lexing
+{
+    /**
+     * \brief Stores the tokens of a whole name as struct-of-arrays.
+     * \details Each token is described by its offset and length in the source text, its kind and the index into the
+     * keyword- or operator-collection (if applicable).
+     * Each row forms a `PackedToken`, thus the same limits apply. Once a token exceeds them, the buffer is marked as
+     * overflowed and keeps the content of each token unpacked instead, so that huge names are still described
+     * faithfully.
+     * Sources containing control characters are marked as well, so that the caller can reject them.
+     *
+     * Clearing the buffer keeps the allocated capacity, so that a buffer can be reused for multiple names.
+     * All arrays are allocated from the memory-resource given at construction (the default resource otherwise).
+     * \see Lexer::tokenize_all
+     */
+    class TokenBuffer
+    {
+    public:
+        using Kind = PackedToken::Kind;
+
+        static constexpr Kind endKind = PackedToken::endKind;
+        static constexpr Kind spaceKind = PackedToken::spaceKind;
+        static constexpr Kind keywordKind = PackedToken::keywordKind;
+        static constexpr Kind opOrPunctuatorKind = PackedToken::opOrPunctuatorKind;
+        static constexpr Kind identifierKind = PackedToken::identifierKind;
+
+        [[nodiscard]]
+        TokenBuffer() = default;
+
+        /**
+         * \attention The resource must outlive the buffer.
+         */
+        [[nodiscard]]
+        explicit TokenBuffer(std::pmr::memory_resource& resource) noexcept
+            : m_Offsets{&resource},
+              m_Lengths{&resource},
+              m_Kinds{&resource},
+              m_Indices{&resource},
+              m_Contents{&resource}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view source() const noexcept
+        {
+            return m_Source;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::size_t size() const noexcept
+        {
+            return m_Kinds.size();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR bool empty() const noexcept
+        {
+            return m_Kinds.empty();
+        }
+
+        /**
+         * \brief Determines, whether a token exceeded the limits of `PackedToken` since the last reset.
+         * \details In this case, the content of each token is stored unpacked. Thus, `offsets` and `lengths` are
+         * meaningless, but `content` and the token-classes still refer to the source.
+         */
+        [[nodiscard]]
+        constexpr bool overflowed() const noexcept
+        {
+            return m_Overflowed;
+        }
+
+        /**
+         * \brief Determines, whether the lexer encountered a control character since the last reset.
+         * \see Lexer::has_control
+         */
+        [[nodiscard]]
+        constexpr bool has_control() const noexcept
+        {
+            return m_HasControl;
+        }
+
+        /**
+         * \brief Marks the bound source as containing control characters.
+         */
+        constexpr void mark_control() noexcept
+        {
+            m_HasControl = true;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::span<std::uint32_t const> offsets() const noexcept
+        {
+            return m_Offsets;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::span<std::uint16_t const> lengths() const noexcept
+        {
+            return m_Lengths;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::span<Kind const> kinds() const noexcept
+        {
+            return m_Kinds;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::span<std::uint8_t const> indices() const noexcept
+        {
+            return m_Indices;
+        }
+
+        /**
+         * \brief Removes all tokens and binds the buffer to the given source, but keeps the capacity.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void reset(std::string_view const source) noexcept
+        {
+            m_Source = source;
+            m_Overflowed = false;
+            m_HasControl = false;
+            m_Offsets.clear();
+            m_Lengths.clear();
+            m_Kinds.clear();
+            m_Indices.clear();
+            m_Contents.clear();
+        }
+
+        /**
+         * \brief Binds the buffer to the given source, but keeps the first `count` tokens and the capacity.
+         * \details This way, a changed source can be lexed again, starting behind the kept tokens.
+         * \attention The given source must start at the bound source and must still contain the kept tokens.
+         * An overflowed buffer can not keep any tokens.
+         * \see stable_prefix
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void reset(std::string_view const source, std::size_t const count) noexcept
+        {
+            CTNP_ASSERT(count <= size(), "Count exceeds the number of tokens.");
+            CTNP_ASSERT(0u == count || !m_Overflowed, "An overflowed buffer can not keep any tokens.");
+            CTNP_ASSERT(
+                0u == count
+                    || (source.data() == m_Source.data() && m_Offsets[count - 1u] + std::size_t{m_Lengths[count - 1u]} <= source.size()),
+                "Source must contain the kept tokens.");
+
+            m_Source = source;
+            m_Overflowed = false;
+            m_HasControl = false;
+            m_Offsets.resize(count);
+            m_Lengths.resize(count);
+            m_Kinds.resize(count);
+            m_Indices.resize(count);
+            m_Contents.clear();
+        }
+
+        /**
+         * \brief Determines the number of leading tokens, which do not depend on any character at or after the given
+         * offset.
+         * \details Each token is determined by its own characters and a short lookahead, as spaces and identifiers end
+         * at the first delimiter and operators are matched greedily. Thus, these tokens stay valid, if just the
+         * source from the given offset onwards is changed.
+         * The end-token is never stable and an overflowed buffer or a buffer with control characters has no stable
+         * tokens at all.
+         */
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::size_t stable_prefix(std::size_t const offset) const noexcept
+        {
+            std::size_t count{0u};
+            for (; !m_Overflowed && !m_HasControl && count < size() && endKind != m_Kinds[count]; ++count)
+            {
+                std::size_t const lookahead = std::max(std::size_t{m_Lengths[count]} + 1u, opOrPunctuatorLookahead);
+                if (offset < m_Offsets[count] + lookahead)
+                {
+                    break;
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * \brief Extends the bound source, e.g. when the end of a NUL-terminated name is discovered while lexing.
+         * \attention The given source must start at the bound source and must not be shorter.
+         */
+        constexpr void extend_source(std::string_view const source) noexcept
+        {
+            CTNP_ASSERT(source.data() == m_Source.data() && m_Source.size() <= source.size(), "Source must extend the bound source.");
+
+            m_Source = source;
+        }
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR void reserve(std::size_t const count)
+        {
+            m_Offsets.reserve(count);
+            m_Lengths.reserve(count);
+            m_Kinds.reserve(count);
+            m_Indices.reserve(count);
+        }
+
+        /**
+         * \brief Appends the given token, which must refer to the bound source.
+         * \details A token, which does not fit into a `PackedToken`, marks the buffer as overflowed. From then on, the
+         * contents of all tokens are stored unpacked.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void push_back(Token const& token)
+        {
+            if (!m_Overflowed
+                && !PackedToken::fits(token, m_Source))
+            {
+                m_Contents.reserve(size() + 1u);
+                for (std::size_t i = 0u; i < size(); ++i)
+                {
+                    m_Contents.emplace_back(content(i));
+                }
+
+                m_Overflowed = true;
+            }
+
+            if (!m_Overflowed)
+            {
+                push_row(PackedToken::pack(token, m_Source));
+
+                return;
+            }
+
+            m_Contents.emplace_back(token.content);
+            push_row(
+                PackedToken{
+                    .offset = 0u,
+                    .length = 0u,
+                    .kind = static_cast<Kind>(token.classification.index()),
+                    .index = PackedToken::index_of(token.classification)});
+        }
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR void push_back(PackedToken const& token)
+        {
+            if (m_Overflowed)
+            {
+                m_Contents.emplace_back(token.content(m_Source));
+            }
+
+            push_row(token);
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR PackedToken packed(std::size_t const i) const noexcept
+        {
+            CTNP_ASSERT(i < size(), "Index out of bounds.");
+
+            return PackedToken{
+                .offset = m_Offsets[i],
+                .length = m_Lengths[i],
+                .kind = m_Kinds[i],
+                .index = m_Indices[i]};
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::string_view content(std::size_t const i) const noexcept
+        {
+            if (m_Overflowed)
+            {
+                CTNP_ASSERT(i < size(), "Index out of bounds.");
+
+                return m_Contents[i];
+            }
+
+            return packed(i).content(m_Source);
+        }
+
+        /**
+         * \brief Returns the classification of the token at the given index, which must be of the given class.
+         * \details Just the requested class is constructed from the arrays, thus this is cheaper than reconstructing
+         * the full token.
+         */
+        template <typename TokenClass>
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR TokenClass get(std::size_t const i) const noexcept
+        {
+            CTNP_ASSERT(detail::token_kind<TokenClass>() == m_Kinds[i], "Token is of a different kind.", m_Kinds[i]);
+
+            if constexpr (std::same_as<token::Identifier, TokenClass>)
+            {
+                return token::Identifier{.content = content(i), .flags = m_Indices[i]};
+            }
+            else if constexpr (std::same_as<token::Keyword, TokenClass> || std::same_as<token::OperatorOrPunctuator, TokenClass>)
+            {
+                return TokenClass{std::ptrdiff_t{m_Indices[i]}};
+            }
+            else
+            {
+                return TokenClass{};
+            }
+        }
+
+        /**
+         * \brief Invokes the visitor with the content and the classification of the token at the given index.
+         */
+        template <typename Visitor>
+        CTNP_DETAIL_CONSTEXPR_VECTOR decltype(auto) visit(std::size_t const i, Visitor&& visitor) const
+        {
+            switch (m_Kinds[i])
+            {
+            case spaceKind:
+                return std::invoke(std::forward<Visitor>(visitor), content(i), get<token::Space>(i));
+
+            case keywordKind:
+                return std::invoke(std::forward<Visitor>(visitor), content(i), get<token::Keyword>(i));
+
+            case opOrPunctuatorKind:
+                return std::invoke(std::forward<Visitor>(visitor), content(i), get<token::OperatorOrPunctuator>(i));
+
+            case identifierKind:
+                return std::invoke(std::forward<Visitor>(visitor), content(i), get<token::Identifier>(i));
+
+            case endKind: [[fallthrough]];
+            default:
+                return std::invoke(std::forward<Visitor>(visitor), content(i), token::End{});
+            }
+        }
+
+        /**
+         * \brief Reconstructs the full token at the given index.
+         */
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Token operator[](std::size_t const i) const noexcept
+        {
+            return visit(
+                i,
+                [](std::string_view const content, auto const& tokenClass) noexcept {
+                    return Token{.content = content, .classification = tokenClass};
+                });
+        }
+
+    private:
+        // The greedy matching of operators examines at most one character after the longest operator.
+        static constexpr std::size_t opOrPunctuatorLookahead = std::ranges::max(
+                                                                   token::OperatorOrPunctuator::textCollection
+                                                                   | std::views::transform([](std::string_view const text) { return text.size(); }))
+                                                             + 1u;
+
+        std::string_view m_Source{};
+        bool m_Overflowed{false};
+        bool m_HasControl{false};
+        std::pmr::vector<std::uint32_t> m_Offsets{};
+        std::pmr::vector<std::uint16_t> m_Lengths{};
+        std::pmr::vector<Kind> m_Kinds{};
+        std::pmr::vector<std::uint8_t> m_Indices{};
+        // Is just filled, when the buffer is overflowed.
+        std::pmr::vector<std::string_view> m_Contents{};
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR void push_row(PackedToken const& token)
+        {
+            m_Offsets.emplace_back(token.offset);
+            m_Lengths.emplace_back(token.length);
+            m_Kinds.emplace_back(token.kind);
+            m_Indices.emplace_back(token.index);
+        }
+    };
+
+    /**
+     * \brief Iterates over an already filled `TokenBuffer`.
+     * \details The cursor reads the token arrays directly. Just the classification of the examined token is
+     * constructed on demand, thus no full `Token` is reconstructed per step.
+     */
+    class TokenCursor
+    {
+    public:
+        using Kind = TokenBuffer::Kind;
+
+        [[nodiscard]]
+        TokenCursor() = default;
+
+        /**
+         * \attention The buffer must outlive the cursor and must be terminated by an end-token.
+         */
+        [[nodiscard]]
+        explicit CTNP_DETAIL_CONSTEXPR_VECTOR TokenCursor(TokenBuffer const& buffer) noexcept
+            : TokenCursor{buffer, 0u}
+        {
+        }
+
+        /**
+         * \brief Resumes the iteration at the given position.
+         * \attention The buffer must outlive the cursor and must be terminated by an end-token.
+         */
+        [[nodiscard]]
+        explicit CTNP_DETAIL_CONSTEXPR_VECTOR TokenCursor(TokenBuffer const& buffer, std::size_t const position) noexcept
+            : m_Buffer{&buffer},
+              m_Index{position}
+        {
+            CTNP_ASSERT(!buffer.empty() && TokenBuffer::endKind == buffer.kinds().back(), "Buffer must be terminated by an end-token.");
+            CTNP_ASSERT(position < buffer.size(), "Position is out of bounds.");
+        }
+
+        /**
+         * \brief Returns the kind of the next token.
+         */
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Kind kind() const noexcept
+        {
+            CTNP_ASSERT(m_Buffer, "No buffer bound.");
+
+            return m_Buffer->kinds()[m_Index];
+        }
+
+        /**
+         * \brief Returns the content of the next token.
+         */
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::string_view content() const noexcept
+        {
+            CTNP_ASSERT(m_Buffer, "No buffer bound.");
+
+            return m_Buffer->content(m_Index);
+        }
+
+        /**
+         * \brief Returns the classification of the next token, if it's of the given class.
+         */
+        template <typename TokenClass>
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::optional<TokenClass> peek_if() const noexcept
+        {
+            if (detail::token_kind<TokenClass>() != kind())
+            {
+                return std::nullopt;
+            }
+
+            return m_Buffer->get<TokenClass>(m_Index);
+        }
+
+        /**
+         * \brief Consumes the next token.
+         * \details The end-token is repeated, when the cursor reaches it.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void advance() noexcept
+        {
+            CTNP_ASSERT(m_Buffer, "No buffer bound.");
+
+            if (m_Index + 1u < m_Buffer->size())
+            {
+                ++m_Index;
+            }
+        }
+
+        /**
+         * \brief Consumes the next token and invokes the visitor with its content and classification.
+         * \see TokenBuffer::visit
+         */
+        template <typename Visitor>
+        CTNP_DETAIL_CONSTEXPR_VECTOR decltype(auto) visit_next(Visitor&& visitor)
+        {
+            std::size_t const index = m_Index;
+            advance();
+
+            return m_Buffer->visit(index, std::forward<Visitor>(visitor));
+        }
+
+        /**
+         * \brief Returns the index of the next token.
+         */
+        [[nodiscard]]
+        constexpr std::size_t position() const noexcept
+        {
+            return m_Index;
+        }
+
+    private:
+        TokenBuffer const* m_Buffer{};
+        std::size_t m_Index{};
+    };
+}
+
+#endif
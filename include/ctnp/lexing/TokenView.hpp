@@ -0,0 +1,140 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_LEXING_TOKEN_VIEW_HPP
+#define CTNP_LEXING_TOKEN_VIEW_HPP
+
+#pragma once
+
+#include "ctnp/config/Config.hpp"
+#include "ctnp/lexing/Lexer.hpp"
+#include "ctnp/lexing/Tokens.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+namespace ctnp::lexing
+{
+    /**
+     * \brief Lazy input-view over the tokens of a name.
+     * \details Tokens are lexed on demand while iterating, so nothing is materialized and consumers may stop early.
+     * The final end-token is not part of the range.
+     *
+     * The view only refers to the name, thus it's a borrowed range: iterators stay valid, even when the view itself
+     * is destroyed. The name must outlive all iterators, though.
+     * \see tokens
+     */
+    class TokenView
+        : public std::ranges::view_interface<TokenView>
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using value_type = Token;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::input_iterator_tag;
+
+            [[nodiscard]]
+            explicit constexpr Iterator(Lexer lexer) noexcept
+                : m_Lexer{std::move(lexer)}
+            {
+            }
+
+            [[nodiscard]]
+            constexpr Token const& operator*() const noexcept
+            {
+                return m_Lexer.peek();
+            }
+
+            constexpr Iterator& operator++() noexcept
+            {
+                std::ignore = m_Lexer.next();
+
+                return *this;
+            }
+
+            constexpr void operator++(int) noexcept
+            {
+                ++*this;
+            }
+
+            [[nodiscard]]
+            friend constexpr bool operator==(Iterator const& iter, [[maybe_unused]] std::default_sentinel_t const sentinel) noexcept
+            {
+                return std::holds_alternative<token::End>(iter.m_Lexer.peek().classification);
+            }
+
+        private:
+            Lexer m_Lexer;
+        };
+
+        [[nodiscard]]
+        explicit constexpr TokenView(std::string_view const name) noexcept
+            : m_Lexer{name}
+        {
+        }
+
+        /**
+         * \brief Lazily lexes the given NUL-terminated name.
+         * \see Lexer::Lexer(char const*)
+         */
+        [[nodiscard]]
+        explicit constexpr TokenView(char const* const name) noexcept
+            : m_Lexer{name}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr Iterator begin() const noexcept
+        {
+            return Iterator{m_Lexer};
+        }
+
+        [[nodiscard]]
+        static constexpr std::default_sentinel_t end() noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        Lexer m_Lexer;
+    };
+
+    /**
+     * \brief Creates a lazy view over the tokens of the given name.
+     * \details Composes with the standard range adaptors, e.g.
+     * \code{.cpp}
+     * bool const hasOperator = std::ranges::any_of(
+     *     lexing::tokens(name),
+     *     [](Token const& token) { return token::TokenClass{token::Keyword{"operator"}} == token.classification; });
+     * \endcode
+     */
+    [[nodiscard]]
+    constexpr TokenView tokens(std::string_view const name) noexcept
+    {
+        return TokenView{name};
+    }
+
+    [[nodiscard]]
+    constexpr TokenView tokens(char const* const name) noexcept
+    {
+        return TokenView{name};
+    }
+}
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<ctnp::lexing::TokenView> = true;
+
+static_assert(std::ranges::view<ctnp::lexing::TokenView>);
+static_assert(std::ranges::input_range<ctnp::lexing::TokenView>);
+static_assert(std::ranges::borrowed_range<ctnp::lexing::TokenView>);
+
+#endif
@@ -13,7 +13,12 @@
 
 #include <algorithm>
 #include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string_view>
+#include <type_traits>
 #include <variant>
 
 namespace ctnp::lexing::detail
@@ -39,6 +44,10 @@ namespace ctnp::lexing::detail
         constexpr std::array access = std::to_array<std::string_view>({".", ".*", "->", "->*"});
         constexpr std::array specialAngles = std::to_array<std::string_view>({"<:", ":>", "<%", "%>"});
         constexpr std::array rest = std::to_array<std::string_view>({"::", ";", ",", ":", "...", "?"});
+
+        // Subsets of the keywords above, which are used to derive the keyword properties.
+        constexpr std::array qualifierKeywords = std::to_array<std::string_view>({"const", "volatile", "noexcept"});
+        constexpr std::array typeContextKeywords = std::to_array<std::string_view>({"struct", "class", "enum"});
     }
 
     [[nodiscard]]
@@ -78,6 +87,118 @@ namespace ctnp::lexing::detail
 
         return collection;
     }
+
+    /**
+     * \brief Bit-flags, describing how the parser shall treat a keyword.
+     */
+    enum KeywordProperty : std::uint8_t
+    {
+        typeKeyword = 1u << 0u,
+        qualifierKeyword = 1u << 1u,
+        typeContextKeyword = 1u << 2u,
+        operatorLikeKeyword = 1u << 3u
+    };
+
+    template <std::size_t n>
+    [[nodiscard]]
+    consteval auto make_keyword_properties(std::array<std::string_view, n> const& collection) noexcept
+    {
+        std::array<std::uint8_t, n> properties{};
+
+        auto const assign = [&](auto const& texts, KeywordProperty const property) {
+            for (std::string_view const text : texts)
+            {
+                auto const iter = util::binary_find(collection, text);
+                CTNP_ASSERT(iter != collection.cend(), "Unknown keyword.");
+                properties[std::ranges::distance(collection.cbegin(), iter)] |= property;
+            }
+        };
+
+        assign(texts::typeKeywords, typeKeyword);
+        assign(texts::qualifierKeywords, qualifierKeyword);
+        assign(texts::typeContextKeywords, typeContextKeyword);
+        assign(texts::otherKeywords, operatorLikeKeyword);
+
+        return properties;
+    }
+
+    /**
+     * \brief Perfect hash-table, which maps each keyword onto its own slot.
+     */
+    template <std::size_t n>
+    struct KeywordHashTable
+    {
+        static constexpr std::size_t slotCount = 256u;
+
+        std::uint32_t seed{};
+        std::size_t maxLength{};
+        std::array<std::int8_t, slotCount> slots{};
+
+        [[nodiscard]]
+        static constexpr std::size_t hash(std::string_view const text, std::uint32_t const seed) noexcept
+        {
+            // FNV-1a with a custom offset-basis. The top bits are the best distributed ones.
+            std::uint32_t value{seed};
+            for (char const c : text)
+            {
+                value = (value ^ static_cast<unsigned char>(c)) * 16777619u;
+            }
+
+            return value >> 24u;
+        }
+
+        /**
+         * \brief Determines the index of the given keyword.
+         * \return The index into the keyword-collection or `-1`, if the text is not a keyword.
+         */
+        [[nodiscard]]
+        constexpr std::ptrdiff_t find(std::array<std::string_view, n> const& collection, std::string_view const text) const noexcept
+        {
+            if (text.empty()
+                || maxLength < text.size())
+            {
+                return -1;
+            }
+
+            if (std::int8_t const index = slots[hash(text, seed)];
+                0 <= index
+                && collection[index] == text)
+            {
+                return index;
+            }
+
+            return -1;
+        }
+    };
+
+    template <std::size_t n>
+    [[nodiscard]]
+    consteval auto make_keyword_hash_table(std::array<std::string_view, n> const& collection) noexcept
+    {
+        static_assert(n < 128u, "Too many keywords for the slot type.");
+
+        KeywordHashTable<n> table{};
+        table.maxLength = std::ranges::max(collection, {}, &std::string_view::size).size();
+
+        // Start with the regular FNV offset-basis and simply try the following ones, until no collisions occur.
+        for (table.seed = 2166136261u;; ++table.seed)
+        {
+            std::ranges::fill(table.slots, std::int8_t{-1});
+
+            bool isPerfect{true};
+            for (std::size_t i{}; isPerfect && i < n; ++i)
+            {
+                auto& slot = table.slots[KeywordHashTable<n>::hash(collection[i], table.seed)];
+                isPerfect = slot < 0;
+                slot = static_cast<std::int8_t>(i);
+            }
+
+            if (isPerfect)
+            {
+                return table;
+            }
+        }
+    }
 }
 
 namespace ctnp::lexing::token
@@ -93,13 +214,24 @@ namespace ctnp::lexing::token
     {
     public:
         static constexpr std::array textCollection = detail::make_keyword_collection();
+        static constexpr std::array propertyCollection = detail::make_keyword_properties(textCollection);
+        static constexpr auto hashTable = detail::make_keyword_hash_table(textCollection);
+
+        /**
+         * \brief Determines the index of the given keyword text.
+         * \details This performs a lookup in a compile-time generated perfect hash-table, thus requires just one
+         * length-check, one hash-computation and one string comparison.
+         * \return The keyword index or `-1`, if the text does not denote a keyword.
+         */
+        [[nodiscard]]
+        static constexpr std::ptrdiff_t find(std::string_view const& text) noexcept
+        {
+            return hashTable.find(textCollection, text);
+        }
 
         [[nodiscard]]
         explicit constexpr Keyword(std::string_view const& text) noexcept
-            : Keyword{
-                  std::ranges::distance(
-                      textCollection.cbegin(),
-                      util::binary_find(textCollection, text))}
+            : Keyword{find(text)}
         {
         }
 
@@ -110,17 +242,65 @@ namespace ctnp::lexing::token
             CTNP_ASSERT(0 <= m_KeywordIndex && m_KeywordIndex < std::ranges::ssize(textCollection), "Invalid keyword.", m_KeywordIndex);
         }
 
+        [[nodiscard]]
+        constexpr std::ptrdiff_t index() const noexcept
+        {
+            return m_KeywordIndex;
+        }
+
         [[nodiscard]]
         constexpr std::string_view text() const noexcept
         {
             return textCollection[m_KeywordIndex];
         }
 
+        /**
+         * \brief Determines, whether the keyword denotes a builtin-type (e.g. `int` or `unsigned`).
+         */
+        [[nodiscard]]
+        constexpr bool is_type() const noexcept
+        {
+            return has_property(detail::typeKeyword);
+        }
+
+        /**
+         * \brief Determines, whether the keyword is one of `const`, `volatile` or `noexcept`.
+         */
+        [[nodiscard]]
+        constexpr bool is_qualifier() const noexcept
+        {
+            return has_property(detail::qualifierKeyword);
+        }
+
+        /**
+         * \brief Determines, whether the keyword is one of `class`, `struct` or `enum`.
+         */
+        [[nodiscard]]
+        constexpr bool is_type_context() const noexcept
+        {
+            return has_property(detail::typeContextKeyword);
+        }
+
+        /**
+         * \brief Determines, whether the keyword may directly follow the `operator` keyword (e.g. `new`).
+         */
+        [[nodiscard]]
+        constexpr bool is_operator_like() const noexcept
+        {
+            return has_property(detail::operatorLikeKeyword);
+        }
+
         [[nodiscard]]
         bool operator==(Keyword const&) const = default;
 
     private:
         std::ptrdiff_t m_KeywordIndex;
+
+        [[nodiscard]]
+        constexpr bool has_property(detail::KeywordProperty const property) const noexcept
+        {
+            return 0u != (propertyCollection[m_KeywordIndex] & property);
+        }
     };
 
     class OperatorOrPunctuator
@@ -144,6 +324,12 @@ namespace ctnp::lexing::token
             CTNP_ASSERT(0 <= m_TextIndex && m_TextIndex < std::ranges::ssize(textCollection), "Invalid operator or punctuator.", m_TextIndex);
         }
 
+        [[nodiscard]]
+        constexpr std::ptrdiff_t index() const noexcept
+        {
+            return m_TextIndex;
+        }
+
         [[nodiscard]]
         constexpr std::string_view text() const noexcept
         {
@@ -160,10 +346,99 @@ namespace ctnp::lexing::token
     class Identifier
     {
     public:
+        /**
+         * \brief Bit-flags, describing the properties of an identifier.
+         * \details These are determined once, so that consumers can simply test for bits instead of inspecting the
+         * content over and over.
+         */
+        enum Flag : std::uint8_t
+        {
+            none = 0u,
+            // The identifier starts with `__`, like call-conventions or other compiler specific tokens.
+            reserved = 1u << 0u,
+            // The identifier denotes a builtin type. This is never set by the lexer, as those are keywords.
+            builtin = 1u << 1u,
+            // Lambda in form of `{lambda(args)#\d+}`.
+            braceLambda = 1u << 2u,
+            // Lambda in form of `'lambda\d*'`.
+            quotedLambda = 1u << 3u,
+            // Msvc lambda in form of `<lambda_\d+>`.
+            msvcLambda = 1u << 4u,
+            // Gcc source-location lambda in form of `<lambda(args)>`.
+            angleLambda = 1u << 5u,
+            // Identifier in form of `` `content' ``.
+            backtickQuoted = 1u << 6u,
+            // Msvc auxiliary namespace in form of `` `\d+' ``.
+            msvcAuxiliary = 1u << 7u
+        };
+
         std::string_view content;
+        std::uint8_t flags{none};
+
+        /**
+         * \brief Determines the flags of the given identifier content.
+         * \note The lexer itself only produces plain identifiers, but the parser assembles placeholders (e.g.
+         * lambdas) from multiple tokens and classifies them via this function, too.
+         */
+        [[nodiscard]]
+        static constexpr std::uint8_t classify(std::string_view const content) noexcept
+        {
+            std::uint8_t result{none};
+            if (content.starts_with("__"))
+            {
+                result |= reserved;
+            }
+
+            if (content.starts_with("{lambda(")
+                && content.ends_with('}'))
+            {
+                result |= braceLambda;
+            }
+            else if (content.starts_with("'lambda")
+                     && content.ends_with('\''))
+            {
+                result |= quotedLambda;
+            }
+            else if (content.starts_with("<lambda_")
+                     && content.ends_with('>'))
+            {
+                result |= msvcLambda;
+            }
+            else if (content.starts_with("<lambda(")
+                     && content.ends_with(")>"))
+            {
+                result |= angleLambda;
+            }
+            else if (2u <= content.size()
+                     && content.starts_with('`')
+                     && content.ends_with('\''))
+            {
+                result |= backtickQuoted;
+
+                if (std::ranges::all_of(content.substr(1u, content.size() - 2u), is_digit_char))
+                {
+                    result |= msvcAuxiliary;
+                }
+            }
+
+            return result;
+        }
+
+        [[nodiscard]]
+        constexpr bool has_flags(std::uint8_t const mask) const noexcept
+        {
+            return mask == (flags & mask);
+        }
 
         [[nodiscard]]
         bool operator==(Identifier const&) const = default;
+
+    private:
+        [[nodiscard]]
+        static constexpr bool is_digit_char(char const c) noexcept
+        {
+            return '0' <= c && c <= '9';
+        }
     };
 
     struct End
@@ -190,4 +465,176 @@ namespace ctnp::lexing
     };
 }
 
+namespace ctnp::lexing::detail
+{
+    template <typename TokenClass, typename... Alternatives>
+    [[nodiscard]]
+    consteval std::uint8_t token_kind([[maybe_unused]] std::type_identity<std::variant<Alternatives...>> const variant) noexcept
+    {
+        constexpr std::array matches{std::same_as<TokenClass, Alternatives>...};
+        static_assert(1 == std::ranges::count(matches, true), "TokenClass is not an alternative.");
+
+        return static_cast<std::uint8_t>(
+            std::ranges::distance(matches.cbegin(), std::ranges::find(matches, true)));
+    }
+
+    template <typename TokenClass>
+    [[nodiscard]]
+    consteval std::uint8_t token_kind() noexcept
+    {
+        return token_kind<TokenClass>(std::type_identity<token::TokenClass>{});
+    }
+}
+
+namespace ctnp::lexing
+{
+    /**
+     * \brief Compact 8-byte representation of a `Token`, which is resolved against the source text on demand.
+     * \details Stores the offset and length of the token content within the source, the kind (which equals the
+     * alternative index of `token::TokenClass`) and the index into the keyword- or operator-collection.
+     * For identifiers, the index holds the `token::Identifier` flags instead.
+     * \note Tokens must not exceed `maxLength` characters and must not start behind `maxOffset`.
+     * \see fits
+     */
+    class PackedToken
+    {
+    public:
+        using Kind = std::uint8_t;
+
+        static constexpr Kind endKind = detail::token_kind<token::End>();
+        static constexpr Kind spaceKind = detail::token_kind<token::Space>();
+        static constexpr Kind keywordKind = detail::token_kind<token::Keyword>();
+        static constexpr Kind opOrPunctuatorKind = detail::token_kind<token::OperatorOrPunctuator>();
+        static constexpr Kind identifierKind = detail::token_kind<token::Identifier>();
+
+        static constexpr std::size_t maxOffset = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::size_t maxLength = std::numeric_limits<std::uint16_t>::max();
+
+        static_assert(token::Keyword::textCollection.size() <= std::numeric_limits<std::uint8_t>::max() + 1u);
+        static_assert(token::OperatorOrPunctuator::textCollection.size() <= std::numeric_limits<std::uint8_t>::max() + 1u);
+
+        std::uint32_t offset;
+        std::uint16_t length;
+        Kind kind;
+        std::uint8_t index;
+
+        /**
+         * \brief Determines, whether the given token, which must refer to the given source, can be packed.
+         */
+        [[nodiscard]]
+        static constexpr bool fits(Token const& token, std::string_view const source) noexcept
+        {
+            auto const tokenOffset = token.content.data() - source.data();
+            CTNP_ASSERT(0 <= tokenOffset && static_cast<std::size_t>(tokenOffset) + token.content.size() <= source.size(), "Token does not refer to the source.");
+
+            return static_cast<std::size_t>(tokenOffset) <= maxOffset
+                && token.content.size() <= maxLength;
+        }
+
+        /**
+         * \brief Packs the given token, which must refer to the given source.
+         * \attention The token must fit into the packed representation.
+         */
+        [[nodiscard]]
+        static constexpr PackedToken pack(Token const& token, std::string_view const source) noexcept
+        {
+            auto const tokenOffset = token.content.data() - source.data();
+            CTNP_ASSERT(0 <= tokenOffset && static_cast<std::size_t>(tokenOffset) + token.content.size() <= source.size(), "Token does not refer to the source.");
+            CTNP_ASSERT(static_cast<std::size_t>(tokenOffset) <= maxOffset, "Source is too long.");
+            CTNP_ASSERT(token.content.size() <= maxLength, "Token is too long.", token.content.size());
+
+            return PackedToken{
+                .offset = static_cast<std::uint32_t>(tokenOffset),
+                .length = static_cast<std::uint16_t>(token.content.size()),
+                .kind = static_cast<Kind>(token.classification.index()),
+                .index = index_of(token.classification)};
+        }
+
+        /**
+         * \brief Determines the packed index of the given token-class.
+         * \details This is the index into the keyword- or operator-collection or the flags of an identifier.
+         * Unlike offset and length, the index always fits.
+         */
+        [[nodiscard]]
+        static constexpr std::uint8_t index_of(token::TokenClass const& tokenClass) noexcept
+        {
+            return std::visit(
+                [](auto const& inner) noexcept { return table_index(inner); },
+                tokenClass);
+        }
+
+        [[nodiscard]]
+        constexpr std::string_view content(std::string_view const source) const noexcept
+        {
+            CTNP_ASSERT(offset + std::size_t{length} <= source.size(), "Token does not refer to the source.");
+
+            return source.substr(offset, length);
+        }
+
+        [[nodiscard]]
+        constexpr token::TokenClass classification(std::string_view const source) const noexcept
+        {
+            switch (kind)
+            {
+            case spaceKind:
+                return token::Space{};
+
+            case keywordKind:
+                return token::Keyword{index};
+
+            case opOrPunctuatorKind:
+                return token::OperatorOrPunctuator{index};
+
+            case identifierKind:
+                return token::Identifier{.content = content(source), .flags = index};
+
+            case endKind: [[fallthrough]];
+            default:
+                return token::End{};
+            }
+        }
+
+        /**
+         * \brief Reconstructs the full token.
+         */
+        [[nodiscard]]
+        constexpr Token unpack(std::string_view const source) const noexcept
+        {
+            return Token{
+                .content = content(source),
+                .classification = classification(source)};
+        }
+
+        [[nodiscard]]
+        bool operator==(PackedToken const&) const = default;
+
+    private:
+        [[nodiscard]]
+        static constexpr std::uint8_t table_index([[maybe_unused]] auto const& tokenClass) noexcept
+        {
+            return 0u;
+        }
+
+        [[nodiscard]]
+        static constexpr std::uint8_t table_index(token::Keyword const& keyword) noexcept
+        {
+            return static_cast<std::uint8_t>(keyword.index());
+        }
+
+        [[nodiscard]]
+        static constexpr std::uint8_t table_index(token::OperatorOrPunctuator const& op) noexcept
+        {
+            return static_cast<std::uint8_t>(op.index());
+        }
+
+        [[nodiscard]]
+        static constexpr std::uint8_t table_index(token::Identifier const& identifier) noexcept
+        {
+            return identifier.flags;
+        }
+    };
+
+    static_assert(8u == sizeof(PackedToken));
+}
+
 #endif
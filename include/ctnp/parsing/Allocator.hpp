@@ -0,0 +1,129 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_PARSING_ALLOCATOR_HPP
+#define CTNP_PARSING_ALLOCATOR_HPP
+
+#pragma once
+
+#include "ctnp/config/Config.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace ctnp::parsing::detail
+{
+    /**
+     * \brief The memory-resource, which is used by all parser allocations of the current thread.
+     * \details Defaults to `std::pmr::new_delete_resource()` and is temporarily replaced by `ResourceScope`.
+     */
+    [[nodiscard]]
+    inline std::pmr::memory_resource*& active_resource() noexcept
+    {
+        thread_local std::pmr::memory_resource* resource{std::pmr::new_delete_resource()};
+
+        return resource;
+    }
+
+    /**
+     * \brief Installs the given resource as the active resource of the current thread, until the scope is left.
+     * \details Scopes may be nested; each restores the previously active resource.
+     */
+    class ResourceScope
+    {
+    public:
+        [[nodiscard]]
+        explicit ResourceScope(std::pmr::memory_resource& resource) noexcept
+            : m_Previous{std::exchange(active_resource(), &resource)}
+        {
+        }
+
+        ~ResourceScope() noexcept
+        {
+            active_resource() = m_Previous;
+        }
+
+        ResourceScope(ResourceScope const&) = delete;
+        ResourceScope& operator=(ResourceScope const&) = delete;
+        ResourceScope(ResourceScope&&) = delete;
+        ResourceScope& operator=(ResourceScope&&) = delete;
+
+    private:
+        std::pmr::memory_resource* m_Previous;
+    };
+}
+
+namespace ctnp::parsing
+{
+    /**
+     * \brief Allocator of all parser tokens.
+     * \details Default constructed allocators (and thus all default constructed containers of the parser tokens)
+     * draw from the currently active resource. This way, the whole token stack and all nested containers are
+     * allocated from the resource of the `ParserImpl`, without threading it through each reduction.
+     *
+     * Copies and moves of containers keep the resource of their source. Thus, the active resource just determines
+     * where new tokens are allocated, and copying a token never depends on the scope the copy is made in.
+     * \attention Tokens must not outlive the resource they have been allocated from.
+     */
+    template <typename T>
+    class Allocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        [[nodiscard]]
+        Allocator() noexcept
+            : m_Resource{detail::active_resource()}
+        {
+        }
+
+        [[nodiscard]]
+        explicit constexpr Allocator(std::pmr::memory_resource& resource) noexcept
+            : m_Resource{&resource}
+        {
+        }
+
+        template <typename U>
+        [[nodiscard]]
+        explicit(false) constexpr Allocator(Allocator<U> const& other) noexcept
+            : m_Resource{other.resource()}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr T* allocate(std::size_t const n)
+        {
+            return static_cast<T*>(m_Resource->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        constexpr void deallocate(T* const ptr, std::size_t const n) noexcept
+        {
+            m_Resource->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        [[nodiscard]]
+        constexpr std::pmr::memory_resource* resource() const noexcept
+        {
+            return m_Resource;
+        }
+
+        template <typename U>
+        [[nodiscard]]
+        friend constexpr bool operator==(Allocator const& lhs, Allocator<U> const& rhs) noexcept
+        {
+            return lhs.resource() == rhs.resource()
+                || lhs.resource()->is_equal(*rhs.resource());
+        }
+
+    private:
+        std::pmr::memory_resource* m_Resource;
+    };
+}
+
+#endif
@@ -0,0 +1,157 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_PARSING_BOX_HPP
+#define CTNP_PARSING_BOX_HPP
+
+#pragma once
+
+#include "ctnp/config/Config.hpp"
+#include "ctnp/parsing/Allocator.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace ctnp::parsing
+{
+    /**
+     * \brief Uniquely owning, nullable box with value-semantics.
+     * \details This is used to break the recursion of the parser tokens (e.g. a function type, which has a type as
+     * return type). Other than `std::shared_ptr`, there is neither a control-block nor any atomic reference-counting.
+     * Copies are deep and are allocated from the resource of the source, while moves just transfer the ownership.
+     * \tparam T The boxed type. May be incomplete at the point of declaration.
+     */
+    template <typename T>
+    class Box
+    {
+    public:
+        using allocator_type = Allocator<T>;
+
+        ~Box() noexcept
+        {
+            reset();
+        }
+
+        [[nodiscard]]
+        Box() = default;
+
+        [[nodiscard]]
+        Box(Box const& other)
+            : m_Allocator{other.m_Allocator}
+        {
+            if (other)
+            {
+                m_Value = create(*other);
+            }
+        }
+
+        Box& operator=(Box const& other)
+        {
+            if (this != &other)
+            {
+                Box copy{other};
+                swap(copy);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        Box(Box&& other) noexcept
+            : m_Allocator{other.m_Allocator},
+              m_Value{std::exchange(other.m_Value, nullptr)}
+        {
+        }
+
+        Box& operator=(Box&& other) noexcept
+        {
+            Box moved{std::move(other)};
+            swap(moved);
+
+            return *this;
+        }
+
+        /**
+         * \brief Creates a new box, containing a `T` constructed from the given arguments.
+         */
+        template <typename... Args>
+        [[nodiscard]]
+        static Box make(Args&&... args)
+        {
+            Box box{};
+            box.m_Value = box.create(std::forward<Args>(args)...);
+
+            return box;
+        }
+
+        [[nodiscard]]
+        explicit operator bool() const noexcept
+        {
+            return nullptr != m_Value;
+        }
+
+        [[nodiscard]]
+        T& operator*() const noexcept
+        {
+            CTNP_ASSERT(m_Value, "Box is empty.");
+
+            return *m_Value;
+        }
+
+        [[nodiscard]]
+        T* operator->() const noexcept
+        {
+            CTNP_ASSERT(m_Value, "Box is empty.");
+
+            return m_Value;
+        }
+
+        [[nodiscard]]
+        T* get() const noexcept
+        {
+            return m_Value;
+        }
+
+        void reset() noexcept
+        {
+            if (m_Value)
+            {
+                std::allocator_traits<allocator_type>::destroy(m_Allocator, m_Value);
+                std::allocator_traits<allocator_type>::deallocate(m_Allocator, std::exchange(m_Value, nullptr), 1u);
+            }
+        }
+
+        void swap(Box& other) noexcept
+        {
+            using std::swap;
+            swap(m_Allocator, other.m_Allocator);
+            swap(m_Value, other.m_Value);
+        }
+
+    private:
+        allocator_type m_Allocator{};
+        T* m_Value{nullptr};
+
+        template <typename... Args>
+        [[nodiscard]]
+        T* create(Args&&... args)
+        {
+            T* const value = std::allocator_traits<allocator_type>::allocate(m_Allocator, 1u);
+            try
+            {
+                std::allocator_traits<allocator_type>::construct(m_Allocator, value, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                std::allocator_traits<allocator_type>::deallocate(m_Allocator, value, 1u);
+                throw;
+            }
+
+            return value;
+        }
+    };
+}
+
+#endif
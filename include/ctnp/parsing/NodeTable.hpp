@@ -0,0 +1,425 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_PARSING_NODE_TABLE_HPP
+#define CTNP_PARSING_NODE_TABLE_HPP
+
+#pragma once
+
+#include "ctnp/config/Config.hpp"
+#include "ctnp/parsing/Allocator.hpp"
+#include "ctnp/parsing/Tokens.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ctnp::parsing
+{
+    /**
+     * \brief Fixed-size node of a `NodeTable`.
+     * \details Each node corresponds to exactly one `parser_visitor` callback.
+     */
+    struct Node
+    {
+        enum Kind : std::uint8_t
+        {
+            unrecognized,
+            begin,
+            end,
+            beginType,
+            endType,
+            beginScope,
+            endScope,
+            identifier,
+            arg,
+            beginTemplateArgs,
+            endTemplateArgs,
+            constSpec,
+            volatileSpec,
+            noexceptSpec,
+            ptr,
+            lvalueRef,
+            rvalueRef,
+            beginFunction,
+            endFunction,
+            beginReturnType,
+            endReturnType,
+            beginFunctionArgs,
+            endFunctionArgs,
+            beginFunctionPtr,
+            endFunctionPtr,
+            beginOperatorIdentifier,
+            endOperatorIdentifier
+        };
+
+        // The content of `identifier` and `unrecognized` nodes; empty otherwise.
+        std::string_view content{};
+
+        // The index one past the last node of the subtree, which is started by this node.
+        // Nodes, which do not start a subtree, refer to their direct successor.
+        std::uint32_t extent{};
+
+        // The argument count of `beginTemplateArgs` and `beginFunctionArgs` nodes.
+        std::uint32_t count{};
+
+        Kind kind{unrecognized};
+
+        // See `lexing::token::Identifier::Flag`.
+        std::uint8_t flags{};
+    };
+
+    static_assert(std::is_trivially_copyable_v<Node>);
+}
+
+namespace ctnp::parsing::detail
+{
+    /**
+     * \brief Emits the visitor callback, which corresponds to the given node.
+     */
+    template <typename Visitor>
+    constexpr void dispatch(Visitor& visitor, Node const& node)
+    {
+        // clang-format off
+        switch (node.kind)
+        {
+        case Node::unrecognized:            visitor.unrecognized(node.content); break;
+        case Node::begin:                   visitor.begin(); break;
+        case Node::end:                     visitor.end(); break;
+        case Node::beginType:               visitor.begin_type(); break;
+        case Node::endType:                 visitor.end_type(); break;
+        case Node::beginScope:              visitor.begin_scope(); break;
+        case Node::endScope:                visitor.end_scope(); break;
+        case Node::arg:                     visitor.add_arg(); break;
+        case Node::beginTemplateArgs:       visitor.begin_template_args(static_cast<std::ptrdiff_t>(node.count)); break;
+        case Node::endTemplateArgs:         visitor.end_template_args(); break;
+        case Node::constSpec:               visitor.add_const(); break;
+        case Node::volatileSpec:            visitor.add_volatile(); break;
+        case Node::noexceptSpec:            visitor.add_noexcept(); break;
+        case Node::ptr:                     visitor.add_ptr(); break;
+        case Node::lvalueRef:               visitor.add_lvalue_ref(); break;
+        case Node::rvalueRef:               visitor.add_rvalue_ref(); break;
+        case Node::beginFunction:           visitor.begin_function(); break;
+        case Node::endFunction:             visitor.end_function(); break;
+        case Node::beginReturnType:         visitor.begin_return_type(); break;
+        case Node::endReturnType:           visitor.end_return_type(); break;
+        case Node::beginFunctionArgs:       visitor.begin_function_args(static_cast<std::ptrdiff_t>(node.count)); break;
+        case Node::endFunctionArgs:         visitor.end_function_args(); break;
+        case Node::beginFunctionPtr:        visitor.begin_function_ptr(); break;
+        case Node::endFunctionPtr:          visitor.end_function_ptr(); break;
+        case Node::beginOperatorIdentifier: visitor.begin_operator_identifier(); break;
+        case Node::endOperatorIdentifier:   visitor.end_operator_identifier(); break;
+        case Node::identifier:
+            if constexpr (identifier_flags_visitor<Visitor&>)
+            {
+                visitor.add_identifier(node.content, node.flags);
+            }
+            else
+            {
+                visitor.add_identifier(node.content);
+            }
+            break;
+        default:
+            CTNP_ASSERT(false, "Invalid node kind.");
+        }
+        // clang-format on
+    }
+}
+
+namespace ctnp::parsing
+{
+    /**
+     * \brief Flat, pre-ordered storage of a whole parse-result.
+     * \details Other than the token-tree, which spreads a single name across plenty of heap-blocks, the table stores
+     * all nodes contiguously. The subtree of each node is given by the index-range `[i, extent)`.
+     *
+     * As nodes are trivially copyable, copying a table is a single `memcpy`. The table just refers to the parsed
+     * name, though; thus the name must outlive the table.
+     * \see detail::NodeRecorder
+     */
+    class NodeTable
+    {
+    public:
+        using NodeSequence = std::vector<Node, Allocator<Node>>;
+
+        [[nodiscard]]
+        NodeTable() = default;
+
+        [[nodiscard]]
+        explicit NodeTable(std::pmr::memory_resource& resource) noexcept
+            : m_Nodes{Allocator<Node>{resource}}
+        {
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::span<Node const> nodes() const noexcept
+        {
+            return m_Nodes;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::size_t size() const noexcept
+        {
+            return m_Nodes.size();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR bool empty() const noexcept
+        {
+            return m_Nodes.empty();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Node const& operator[](std::size_t const i) const noexcept
+        {
+            CTNP_ASSERT(i < size(), "Index out of bounds.");
+
+            return m_Nodes[i];
+        }
+
+        /**
+         * \brief Removes all nodes, but keeps the capacity.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void clear() noexcept
+        {
+            m_Nodes.clear();
+        }
+
+        /**
+         * \brief Keeps only the first `count` nodes, but keeps the capacity.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void truncate(std::size_t const count) noexcept
+        {
+            CTNP_ASSERT(count <= size(), "Count out of bounds.");
+
+            m_Nodes.resize(count);
+        }
+
+        /**
+         * \brief Appends the given node and returns its index.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::uint32_t push_back(Node const& node)
+        {
+            auto const index = static_cast<std::uint32_t>(m_Nodes.size());
+            m_Nodes.emplace_back(node);
+
+            return index;
+        }
+
+        /**
+         * \brief Closes the subtree, which is started by the node at the given index, at the current end.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void close(std::uint32_t const index) noexcept
+        {
+            CTNP_ASSERT(index < size(), "Index out of bounds.");
+
+            m_Nodes[index].extent = static_cast<std::uint32_t>(m_Nodes.size());
+        }
+
+        /**
+         * \brief Drives the given visitor by a single linear pass over all nodes.
+         */
+        template <parser_visitor Visitor>
+        CTNP_DETAIL_CONSTEXPR_VECTOR void replay(Visitor& visitor) const
+        {
+            auto& unwrapped = unwrap_visitor(visitor);
+            for (Node const& node : m_Nodes)
+            {
+                detail::dispatch(unwrapped, node);
+            }
+        }
+
+    private:
+        NodeSequence m_Nodes{};
+    };
+}
+
+namespace ctnp::parsing::detail
+{
+    /**
+     * \brief Visitor, which records all callbacks into a `NodeTable`.
+     */
+    class NodeRecorder
+    {
+    public:
+        [[nodiscard]]
+        explicit NodeRecorder(NodeTable& table) noexcept
+            : m_Table{&table}
+        {
+        }
+
+        void unrecognized(std::string_view const content)
+        {
+            add(Node{.content = content, .kind = Node::unrecognized});
+        }
+
+        void begin()
+        {
+            open(Node{.kind = Node::begin});
+        }
+
+        void end()
+        {
+            close(Node{.kind = Node::end});
+        }
+
+        void begin_type()
+        {
+            open(Node{.kind = Node::beginType});
+        }
+
+        void end_type()
+        {
+            close(Node{.kind = Node::endType});
+        }
+
+        void begin_scope()
+        {
+            open(Node{.kind = Node::beginScope});
+        }
+
+        void end_scope()
+        {
+            close(Node{.kind = Node::endScope});
+        }
+
+        void add_identifier(std::string_view const content)
+        {
+            add_identifier(content, 0u);
+        }
+
+        void add_identifier(std::string_view const content, std::uint8_t const flags)
+        {
+            add(Node{.content = content, .kind = Node::identifier, .flags = flags});
+        }
+
+        void add_arg()
+        {
+            add(Node{.kind = Node::arg});
+        }
+
+        void begin_template_args(std::ptrdiff_t const count)
+        {
+            open(Node{.count = static_cast<std::uint32_t>(count), .kind = Node::beginTemplateArgs});
+        }
+
+        void end_template_args()
+        {
+            close(Node{.kind = Node::endTemplateArgs});
+        }
+
+        void add_const()
+        {
+            add(Node{.kind = Node::constSpec});
+        }
+
+        void add_volatile()
+        {
+            add(Node{.kind = Node::volatileSpec});
+        }
+
+        void add_noexcept()
+        {
+            add(Node{.kind = Node::noexceptSpec});
+        }
+
+        void add_ptr()
+        {
+            add(Node{.kind = Node::ptr});
+        }
+
+        void add_lvalue_ref()
+        {
+            add(Node{.kind = Node::lvalueRef});
+        }
+
+        void add_rvalue_ref()
+        {
+            add(Node{.kind = Node::rvalueRef});
+        }
+
+        void begin_function()
+        {
+            open(Node{.kind = Node::beginFunction});
+        }
+
+        void end_function()
+        {
+            close(Node{.kind = Node::endFunction});
+        }
+
+        void begin_return_type()
+        {
+            open(Node{.kind = Node::beginReturnType});
+        }
+
+        void end_return_type()
+        {
+            close(Node{.kind = Node::endReturnType});
+        }
+
+        void begin_function_args(std::ptrdiff_t const count)
+        {
+            open(Node{.count = static_cast<std::uint32_t>(count), .kind = Node::beginFunctionArgs});
+        }
+
+        void end_function_args()
+        {
+            close(Node{.kind = Node::endFunctionArgs});
+        }
+
+        void begin_function_ptr()
+        {
+            open(Node{.kind = Node::beginFunctionPtr});
+        }
+
+        void end_function_ptr()
+        {
+            close(Node{.kind = Node::endFunctionPtr});
+        }
+
+        void begin_operator_identifier()
+        {
+            open(Node{.kind = Node::beginOperatorIdentifier});
+        }
+
+        void end_operator_identifier()
+        {
+            close(Node{.kind = Node::endOperatorIdentifier});
+        }
+
+    private:
+        NodeTable* m_Table;
+        std::vector<std::uint32_t, Allocator<std::uint32_t>> m_OpenNodes{};
+
+        void add(Node node)
+        {
+            node.extent = static_cast<std::uint32_t>(m_Table->size()) + 1u;
+            m_Table->push_back(node);
+        }
+
+        void open(Node const& node)
+        {
+            m_OpenNodes.emplace_back(m_Table->push_back(node));
+        }
+
+        void close(Node const& node)
+        {
+            CTNP_ASSERT(!m_OpenNodes.empty(), "No open node.");
+
+            add(node);
+            m_Table->close(m_OpenNodes.back());
+            m_OpenNodes.pop_back();
+        }
+    };
+
+    static_assert(parser_visitor<NodeRecorder>);
+    static_assert(identifier_flags_visitor<NodeRecorder>);
+}
+
+#endif
@@ -9,12 +9,34 @@
 #pragma once
 
 #include "ctnp/lexing/Lexer.hpp"
+#include "ctnp/parsing/NodeTable.hpp"
 #include "ctnp/parsing/Tokens.hpp"
+#include "ctnp/parsing/Traversal.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
-#include <optional>
+
+namespace ctnp::parsing
+{
+    /**
+     * \brief The kind of a name, as detected by `Parser::parse_auto`.
+     */
+    enum class NameKind : std::uint8_t
+    {
+        unrecognized,
+        type,
+        function
+    };
+}
 
 namespace ctnp::parsing::detail
 {
@@ -24,8 +46,30 @@ namespace ctnp::parsing::detail
     class ParserImpl
     {
     public:
+        /**
+         * \brief Number of bytes, the internal arena requests from the heap at once.
+         */
+        static constexpr std::size_t arenaBlockSize{4096u};
+
+        /**
+         * \details All tokens (including the results) are allocated from the given resource. If no resource is
+         * given, an internal arena is used, which releases all memory at once, when the parser is destroyed.
+         * \attention The results must not outlive the resource.
+         */
+        [[nodiscard]]
+        explicit ParserImpl(std::string_view const& content, std::pmr::memory_resource* resource = nullptr) noexcept;
+
+        /**
+         * \brief Parses the given NUL-terminated content, without determining its length in advance.
+         * \details The content becomes available via `content()`, once parsing has been started.
+         */
         [[nodiscard]]
-        explicit ParserImpl(std::string_view const& content) noexcept;
+        explicit ParserImpl(char const* content, std::pmr::memory_resource* resource = nullptr) noexcept;
+
+        ParserImpl(ParserImpl const&) = delete;
+        ParserImpl& operator=(ParserImpl const&) = delete;
+        ParserImpl(ParserImpl&&) = delete;
+        ParserImpl& operator=(ParserImpl&&) = delete;
 
         [[nodiscard]]
         constexpr std::string_view content() const noexcept
@@ -33,28 +77,200 @@ namespace ctnp::parsing::detail
             return m_Content;
         }
 
+        /**
+         * \brief Binds the parser to the given content, but keeps the capacity of all internal buffers.
+         */
+        void reset(std::string_view const& content) noexcept;
+
+        /**
+         * \brief Binds the parser to the given NUL-terminated content, but keeps the capacity of all internal buffers.
+         */
+        void reset(char const* content) noexcept;
+
+        /**
+         * \brief Binds the parser to the given content, which has been written over the previous content in place.
+         * \details The first `sharedLength` characters of the content are expected to be unchanged since the previous
+         * parse. Thus, if prefix memoization is enabled, the tokens of that prefix are not lexed again and parsing may
+         * be resumed from a recorded checkpoint within that prefix.
+         * \attention If the content does not start at the address of the previous content, nothing is shared.
+         */
+        void reset(std::string_view const& content, std::size_t sharedLength) noexcept;
+
+        /**
+         * \brief Determines, whether the content of template-args is skipped during subsequent parses.
+         * \details Skipped template-args are just checked token by token and only their number is recorded.
+         * Whenever the region does not provably reduce to a sequence of types (e.g. due to operators), it is parsed
+         * as usual.
+         * \see template_args_discarding_visitor
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void skip_template_args(bool const skip) noexcept
+        {
+            // The recorded checkpoints depend on this option, thus they become stale, whenever it's changed.
+            if (skip != std::exchange(m_SkipTemplateArgs, skip))
+            {
+                m_Checkpoints.clear();
+            }
+        }
+
+        /**
+         * \brief Determines, whether checkpoints of the token-stack are recorded during subsequent table parses.
+         * \details A checkpoint is recorded after each scope-resolution outside of template-args. When the next content
+         * shares a prefix with the current one (see `reset`), parsing resumes from the deepest checkpoint, which only
+         * depends on unchanged tokens, instead of starting from scratch.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void memoize_prefixes(bool const memoize) noexcept
+        {
+            m_MemoizePrefixes = memoize;
+            m_Checkpoints.clear();
+        }
+
         [[nodiscard]]
         TypeResult parse_type();
 
         [[nodiscard]]
         FunctionResult parse_function();
 
+        /**
+         * \brief Parses the content as type and records the visitation of the result into the internal node-table.
+         * \details The table is overwritten by each subsequent call.
+         *
+         * Other than `parse_type`, this streams the events of each template-arg list into an internal flat sequence,
+         * as soon as the list is closed, and immediately releases the tokens of its content. Thus, the token-tree
+         * only holds the currently open template-arg lists in full.
+         */
+        [[nodiscard]]
+        NodeTable const& parse_type_table();
+
+        /**
+         * \brief Parses the content as function and records the visitation of the result into the internal node-table.
+         * \details The table is overwritten by each subsequent call.
+         * \copydetails parse_type_table
+         */
+        [[nodiscard]]
+        NodeTable const& parse_function_table();
+
+        /**
+         * \brief Parses the content as function or as type, whichever matches the final token-stack, and records the
+         * visitation of the result into the internal node-table.
+         * \details As the function reductions already fall back to the type reductions, this requires just a single
+         * pass. The table is overwritten by each subsequent call.
+         * \return The detected kind of the name.
+         */
+        [[nodiscard]]
+        NameKind parse_auto_table();
+
+        /**
+         * \brief Returns the node-table, which has been recorded by the latest parse.
+         */
+        [[nodiscard]]
+        NodeTable const& nodes() const noexcept
+        {
+            return m_Nodes;
+        }
+
     private:
+        /**
+         * \brief Snapshot of the parser state, right after a lexer-token has been handled.
+         */
+        struct Checkpoint
+        {
+            /**
+             * \brief Index of the next lexer-token.
+             */
+            std::size_t position;
+
+            /**
+             * \brief Index of the last lexer-token, which has been examined so far (including lookaheads).
+             */
+            std::size_t horizon;
+
+            std::size_t flushedCount;
+            bool hasConversionOperator;
+            TokenStack tokenStack;
+        };
+
+        std::pmr::monotonic_buffer_resource m_Arena{arenaBlockSize};
+        std::pmr::memory_resource* m_Resource;
         std::string_view m_Content;
-        lexing::Lexer m_Lexer;
+        char const* m_TerminatedContent{nullptr};
+        lexing::TokenBuffer m_Tokens;
+        lexing::TokenCursor m_Cursor{};
         bool m_HasConversionOperator{false};
+        bool m_IsUnparseable{false};
+        bool m_SkipTemplateArgs{false};
+        bool m_FlushTemplateArgs{false};
+        bool m_MemoizePrefixes{false};
+        std::size_t m_SharedLength{0u};
+        std::size_t m_Horizon{0u};
+        std::vector<Checkpoint, Allocator<Checkpoint>> m_Checkpoints;
 
-        std::vector<Token> m_TokenStack{};
+        TokenStack m_TokenStack;
+        NodeTable m_Nodes;
+        NodeTable m_Flushed;
+        NodeTable m_FlushBuffer;
+        Traversal m_Traversal;
 
         template <typename LexerTokenClass>
         [[nodiscard]]
-        constexpr LexerTokenClass const* peek_if() const noexcept
+        std::optional<LexerTokenClass> peek_if() const noexcept
         {
-            return std::get_if<LexerTokenClass>(&m_Lexer.peek().classification);
+            return m_Cursor.peek_if<LexerTokenClass>();
         }
 
         void parse();
 
+        /**
+         * \brief Lexes the content, but keeps all tokens, which are shared with the previous content.
+         * \return The number of kept tokens.
+         */
+        [[nodiscard]]
+        std::size_t tokenize();
+
+        /**
+         * \brief Restores the deepest checkpoint, which only depends on the given number of leading tokens.
+         * \details All checkpoints after that one are discarded.
+         * \return `true`, if a checkpoint has been restored.
+         */
+        [[nodiscard]]
+        bool resume_from_checkpoint(std::size_t sharedCount);
+
+        void record_checkpoint();
+
+        /**
+         * \brief Rejects the whole input, if there is no opening bracket, which the current closing bracket could close.
+         * \details Such a closing bracket can never be reduced, thus parsing will fail anyway.
+         * Placeholders (e.g. `` `a>b' `` or `'lambda>'`) may contain unmatched closers, thus nothing is rejected, while
+         * a backtick or single-quote is open.
+         * \return `true`, if the input has been rejected.
+         */
+        template <token_type Opening>
+        [[nodiscard]]
+        bool reject_unbalanced_closer() noexcept
+        {
+            std::size_t const end = m_TokenStack.size();
+            m_IsUnparseable = !m_TokenStack.find_last_bracket<Opening>(end)
+                           && !m_TokenStack.find_last_bracket<token::OpeningBacktick>(end)
+                           && !m_TokenStack.find_last_bracket<token::ClosingSingleQuote>(end);
+
+            return m_IsUnparseable;
+        }
+
+        /**
+         * \brief Skips the template-args, which have just been opened by the given `<`, if this is safely possible.
+         * \details Just args, which provably reduce to a sequence of types, are skipped. Everything else is left to
+         * the regular reductions, so that the result never differs from parsing the args.
+         * \return `true`, if the template-args have been skipped.
+         */
+        [[nodiscard]]
+        bool try_skip_template_args(std::string_view opening);
+
+        /**
+         * \brief Flushes the events of the template-args of the identifier on top of the stack.
+         * \param mark The number of flushed events, when the template-args have been opened. All events, which have
+         * been flushed since then, belong to nested template-args and are spliced into the new range.
+         */
+        void flush_template_args(std::uint32_t mark);
+
         [[nodiscard]]
         bool merge_with_next_token() const noexcept;
         [[nodiscard]]
@@ -94,41 +310,232 @@ namespace ctnp::parsing
     class Parser
     {
     public:
+        /**
+         * \details All intermediate tokens are allocated from the given resource. If no resource is given, an
+         * internal arena is used instead.
+         */
         [[nodiscard]]
-        explicit constexpr Parser(Visitor visitor, std::string_view content) noexcept(std::is_nothrow_move_constructible_v<Visitor>)
+        explicit constexpr Parser(
+            Visitor visitor,
+            std::string_view content,
+            std::pmr::memory_resource* const resource = nullptr) noexcept(std::is_nothrow_move_constructible_v<Visitor>)
             : m_Visitor{std::move(visitor)},
-              m_Parser{std::move(content)}
+              m_Parser{std::move(content), resource}
         {
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+        }
+
+        /**
+         * \brief Parses the given NUL-terminated content in a single pass.
+         * \details The content is not scanned for its terminator in advance, as the lexer uses it as sentinel.
+         */
+        [[nodiscard]]
+        explicit constexpr Parser(
+            Visitor visitor,
+            char const* const content,
+            std::pmr::memory_resource* const resource = nullptr) noexcept(std::is_nothrow_move_constructible_v<Visitor>)
+            : m_Visitor{std::move(visitor)},
+              m_Parser{content, resource}
+        {
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
         }
 
         void parse_type()
         {
-            auto& unwrapped = unwrap_visitor(m_Visitor);
-            if (std::optional const result = m_Parser.parse_type())
-            {
-                unwrapped.begin();
-                std::invoke(*result, m_Visitor);
-                unwrapped.end();
-            }
-            else
-            {
-                unwrapped.unrecognized(m_Parser.content());
-            }
+            m_Parser.parse_type_table().replay(m_Visitor);
         }
 
         void parse_function()
         {
-            auto& unwrapped = unwrap_visitor(m_Visitor);
-            detail::ResultVisitor<decltype(unwrapped)> visitor{
-                .visitor = unwrapped,
-                .content = m_Parser.content()};
-            std::visit(visitor, m_Parser.parse_function());
+            m_Parser.parse_function_table().replay(m_Visitor);
+        }
+
+        /**
+         * \brief Parses the content either as function or as type, whichever matches.
+         * \return The detected kind of the name.
+         */
+        NameKind parse_auto()
+        {
+            NameKind const kind = m_Parser.parse_auto_table();
+            m_Parser.nodes().replay(m_Visitor);
+
+            return kind;
         }
 
     private:
         Visitor m_Visitor;
         detail::ParserImpl m_Parser;
     };
+
+    /**
+     * \brief Parser, which is reused for many names.
+     * \details The session keeps the capacity of the lexer-buffer, the token-stack and the node-table across subsequent
+     * parses. All intermediate tokens are drawn from an internal pool, which recycles released blocks. Thus, a session
+     * reaches a steady state, in which parsing does not allocate at all.
+     * \note Sessions are not thread-safe; use one session per thread instead.
+     */
+    class ParserSession
+    {
+    public:
+        /**
+         * \details The internal pool requests its blocks from the given upstream resource, or from the default resource,
+         * if no upstream is given.
+         */
+        [[nodiscard]]
+        explicit ParserSession(std::pmr::memory_resource* const upstream = nullptr)
+            : m_Pool{upstream ? upstream : std::pmr::get_default_resource()},
+              m_Parser{std::string_view{}, &m_Pool}
+        {
+        }
+
+        ParserSession(ParserSession const&) = delete;
+        ParserSession& operator=(ParserSession const&) = delete;
+        ParserSession(ParserSession&&) = delete;
+        ParserSession& operator=(ParserSession&&) = delete;
+
+        [[nodiscard]]
+        constexpr std::string_view content() const noexcept
+        {
+            return m_Parser.content();
+        }
+
+        /**
+         * \brief Binds the session to the given content.
+         * \attention The content must outlive the next parse.
+         */
+        void reset(std::string_view const content) noexcept
+        {
+            m_Parser.reset(content);
+        }
+
+        /**
+         * \brief Binds the session to the given NUL-terminated content.
+         * \attention The content must outlive the next parse.
+         */
+        void reset(char const* const content) noexcept
+        {
+            m_Parser.reset(content);
+        }
+
+        template <parser_visitor Visitor>
+        void parse_type(Visitor& visitor)
+        {
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+            m_Parser.parse_type_table().replay(visitor);
+        }
+
+        template <parser_visitor Visitor>
+        void parse_function(Visitor& visitor)
+        {
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+            m_Parser.parse_function_table().replay(visitor);
+        }
+
+        /**
+         * \copydoc Parser::parse_auto
+         */
+        template <parser_visitor Visitor>
+        NameKind parse_auto(Visitor& visitor)
+        {
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+            NameKind const kind = m_Parser.parse_auto_table();
+            m_Parser.nodes().replay(visitor);
+
+            return kind;
+        }
+
+    private:
+        std::pmr::unsynchronized_pool_resource m_Pool;
+        detail::ParserImpl m_Parser;
+    };
+
+    /**
+     * \brief Parser for batches of related names, like the frames of a stack-trace or the entries of a profiler dump.
+     * \details Such names often share long prefixes (e.g. `mylib::detail::engine<...>::`), which just differ in the
+     * final part. Thus, the parser records checkpoints of its token-stack after each scope of a name. The next name,
+     * which shares a prefix with its predecessor, is resumed from the deepest checkpoint within that prefix, instead
+     * of being parsed from scratch.
+     *
+     * Each name is copied into an internal buffer, which is just overwritten after the shared prefix. This way, the
+     * recorded checkpoints keep referring to valid content.
+     * Otherwise, the parser behaves like a `ParserSession`.
+     * \note Just the checkpoints of the latest name are kept, thus batches benefit most, when related names are
+     * adjacent (e.g. sorted).
+     */
+    class BatchParser
+    {
+    public:
+        /**
+         * \copydetails ParserSession::ParserSession
+         */
+        [[nodiscard]]
+        explicit BatchParser(std::pmr::memory_resource* const upstream = nullptr)
+            : m_Pool{upstream ? upstream : std::pmr::get_default_resource()},
+              m_Source{&m_Pool},
+              m_Parser{std::string_view{}, &m_Pool}
+        {
+            m_Parser.memoize_prefixes(true);
+        }
+
+        BatchParser(BatchParser const&) = delete;
+        BatchParser& operator=(BatchParser const&) = delete;
+        BatchParser(BatchParser&&) = delete;
+        BatchParser& operator=(BatchParser&&) = delete;
+
+        /**
+         * \brief Parses the given type name.
+         * \attention The contents reported to the visitor are valid until the next parse.
+         */
+        template <parser_visitor Visitor>
+        void parse_type(std::string_view const name, Visitor& visitor)
+        {
+            bind(name);
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+            m_Parser.parse_type_table().replay(visitor);
+        }
+
+        /**
+         * \brief Parses the given function name.
+         * \copydetails parse_type
+         */
+        template <parser_visitor Visitor>
+        void parse_function(std::string_view const name, Visitor& visitor)
+        {
+            bind(name);
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+            m_Parser.parse_function_table().replay(visitor);
+        }
+
+        /**
+         * \copydoc Parser::parse_auto
+         * \attention The contents reported to the visitor are valid until the next parse.
+         */
+        template <parser_visitor Visitor>
+        NameKind parse_auto(std::string_view const name, Visitor& visitor)
+        {
+            bind(name);
+            m_Parser.skip_template_args(template_args_discarding_visitor<Visitor>);
+            NameKind const kind = m_Parser.parse_auto_table();
+            m_Parser.nodes().replay(visitor);
+
+            return kind;
+        }
+
+    private:
+        std::pmr::unsynchronized_pool_resource m_Pool;
+        std::pmr::string m_Source;
+        detail::ParserImpl m_Parser;
+
+        void bind(std::string_view const name)
+        {
+            auto const sharedLength = static_cast<std::size_t>(
+                std::ranges::mismatch(m_Source, name).in1 - m_Source.cbegin());
+
+            // If the buffer is reallocated, the parser notices the moved content and discards its checkpoints.
+            m_Source.assign(name);
+            m_Parser.reset(m_Source, sharedLength);
+        }
+    };
 }
 
 #endif
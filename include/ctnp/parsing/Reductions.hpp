@@ -6,14 +6,21 @@
 #ifndef CTNP_PARSING_REDUCTIONS_HPP
 #define CTNP_PARSING_REDUCTIONS_HPP
 
-#include "ctnp/TypeList.hpp"
 #include "ctnp/config/Config.hpp"
 #include "ctnp/parsing/Tokens.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <optional>
+#include <ranges>
 #include <span>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <variant>
 
@@ -21,43 +28,55 @@ namespace ctnp::parsing
 {
     namespace detail
     {
-        template <typename Last, typename... Others>
+        /**
+         * \brief Determines, whether the given kinds end with the kinds of the given token-types.
+         * \details Suffixes of up to four tokens are compared at once as a single integer.
+         */
+        template <token_type... Types>
         [[nodiscard]]
-        constexpr bool is_suffix_of(
-            [[maybe_unused]] util::type_list<Last, Others...> const types,
-            std::span<Token const> const tokenStack) noexcept
+        constexpr bool ends_with_kinds(std::span<TokenStack::Kind const> const kinds) noexcept
         {
-            if (tokenStack.empty()
-                || !std::holds_alternative<Last>(tokenStack.back()))
+            constexpr std::size_t count = sizeof...(Types);
+            constexpr std::array<TokenStack::Kind, count> expected{token_kind<Types>()...};
+
+            if (kinds.size() < count)
             {
                 return false;
             }
 
-            if constexpr (0u < sizeof...(Others))
-            {
-                return is_suffix_of(
-                    util::type_list<Others...>{},
-                    tokenStack.first(tokenStack.size() - 1));
-            }
-            else
+            auto const suffix = kinds.last(count);
+            if constexpr (count <= sizeof(std::uint32_t))
             {
-                return true;
+                if (!std::is_constant_evaluated())
+                {
+                    constexpr std::uint32_t packedExpected = std::invoke(
+                        [&] {
+                            std::array<TokenStack::Kind, sizeof(std::uint32_t)> padded{};
+                            std::ranges::copy(expected, padded.begin());
+
+                            return std::bit_cast<std::uint32_t>(padded);
+                        });
+
+                    std::uint32_t packedSuffix{};
+                    std::memcpy(&packedSuffix, suffix.data(), count);
+
+                    return packedExpected == packedSuffix;
+                }
             }
+
+            return std::ranges::equal(suffix, expected);
         }
     }
 
     template <token_type First, token_type... Others>
-    constexpr bool is_suffix_of(std::span<Token const> const tokenStack) noexcept
+    constexpr bool is_suffix_of(TokenStackView const tokenStack) noexcept
     {
-        using types = util::type_list<First, Others...>;
-
-        return 1u + sizeof...(Others) <= tokenStack.size()
-            && detail::is_suffix_of(util::type_list_reverse_t<types>{}, tokenStack);
+        return detail::ends_with_kinds<First, Others...>(tokenStack.kinds());
     }
 
     template <token_type Leading, token_type... Others>
     [[nodiscard]]
-    constexpr auto match_suffix(std::span<Token> const tokenStack) noexcept
+    constexpr auto match_suffix(TokenStackView const tokenStack) noexcept
     {
         if constexpr (0u == sizeof...(Others))
         {
@@ -74,7 +93,7 @@ namespace ctnp::parsing
             std::optional<std::tuple<Leading&, Others&...>> result{};
             if (is_suffix_of<Leading, Others...>(tokenStack))
             {
-                auto const suffix = tokenStack.last(1u + sizeof...(Others));
+                auto const suffix = tokenStack.tokens().last(1u + sizeof...(Others));
 
                 result = std::invoke(
                     [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const) noexcept {
@@ -89,13 +108,13 @@ namespace ctnp::parsing
         }
     }
 
-    constexpr void remove_suffix(std::span<Token>& tokenStack, std::size_t const count) noexcept
+    constexpr void remove_suffix(TokenStackView& tokenStack, std::size_t const count) noexcept
     {
         CTNP_ASSERT(count <= tokenStack.size(), "Count exceeds stack size.");
         tokenStack = tokenStack.first(tokenStack.size() - count);
     }
 
-    constexpr void ignore_space(std::span<Token>& tokenStack) noexcept
+    constexpr void ignore_space(TokenStackView& tokenStack) noexcept
     {
         if (is_suffix_of<token::Space>(tokenStack))
         {
@@ -103,7 +122,7 @@ namespace ctnp::parsing
         }
     }
 
-    constexpr void ignore_reserved_identifier(std::span<Token>& tokenStack) noexcept
+    constexpr void ignore_reserved_identifier(TokenStackView& tokenStack) noexcept
     {
         if (auto const* const id = match_suffix<token::Identifier>(tokenStack);
             id
@@ -119,7 +138,7 @@ namespace ctnp::parsing
 
         inline bool try_reduce_as_scope_sequence(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             if (!is_suffix_of<ScopeResolution>(pendingTokens))
             {
                 return false;
@@ -141,7 +160,7 @@ namespace ctnp::parsing
             }
 
             remove_suffix(pendingTokens, 1u);
-            tokenStack.resize(pendingTokens.size());
+            tokenStack.truncate(pendingTokens.size());
 
             if (auto* sequence = match_suffix<ScopeSequence>(tokenStack))
             {
@@ -159,7 +178,7 @@ namespace ctnp::parsing
 
         CTNP_DETAIL_CONSTEXPR_VECTOR bool try_reduce_as_arg_sequence(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             if (std::optional suffix = match_suffix<ArgSequence, ArgSeparator, Type>(pendingTokens))
             {
                 // Keep ArgSequence
@@ -167,7 +186,7 @@ namespace ctnp::parsing
                 auto& [seq, sep, type] = *suffix;
 
                 seq.types.emplace_back(std::move(type));
-                tokenStack.resize(pendingTokens.size());
+                tokenStack.truncate(pendingTokens.size());
 
                 return true;
             }
@@ -178,7 +197,7 @@ namespace ctnp::parsing
 
                 ArgSequence seq{};
                 seq.types.emplace_back(std::move(*type));
-                tokenStack.resize(pendingTokens.size());
+                tokenStack.truncate(pendingTokens.size());
                 tokenStack.emplace_back(std::move(seq));
 
                 return true;
@@ -189,7 +208,7 @@ namespace ctnp::parsing
 
         constexpr bool try_reduce_as_template_identifier(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             if (!is_suffix_of<ClosingAngle>(pendingTokens))
             {
                 return false;
@@ -223,14 +242,14 @@ namespace ctnp::parsing
             {
                 id->templateArgs.emplace();
             }
-            tokenStack.resize(pendingTokens.size());
+            tokenStack.truncate(pendingTokens.size());
 
             return true;
         }
 
         CTNP_DETAIL_CONSTEXPR_VECTOR bool try_reduce_as_function_context(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             if (!is_suffix_of<ClosingParens>(pendingTokens))
             {
                 return false;
@@ -267,7 +286,7 @@ namespace ctnp::parsing
                 }
             }
 
-            tokenStack.resize(pendingTokens.size());
+            tokenStack.truncate(pendingTokens.size());
             tokenStack.emplace_back(std::move(funCtx));
 
             return true;
@@ -275,7 +294,7 @@ namespace ctnp::parsing
 
         inline bool try_reduce_as_function_identifier(TokenStack& tokenStack)
         {
-            std::span pendingStack{tokenStack};
+            TokenStackView pendingStack{tokenStack};
 
             // There may be a space, when the function is wrapped inside single-quotes.
             ignore_space(pendingStack);
@@ -292,8 +311,8 @@ namespace ctnp::parsing
                     .identifier = std::move(identifier),
                     .context = std::move(funCtx)};
 
-                tokenStack.resize(pendingStack.size() + 1u);
-                tokenStack.back() = std::move(funIdentifier);
+                tokenStack.truncate(pendingStack.size());
+                tokenStack.emplace_back(std::move(funIdentifier));
 
                 return true;
             }
@@ -302,7 +321,7 @@ namespace ctnp::parsing
         }
 
         [[nodiscard]]
-        constexpr bool is_identifier_prefix(std::span<Token const> const tokenStack) noexcept
+        constexpr bool is_identifier_prefix(TokenStackView const tokenStack) noexcept
         {
             return tokenStack.empty()
                 || is_suffix_of<Space>(tokenStack)
@@ -319,37 +338,43 @@ namespace ctnp::parsing
         constexpr bool try_reduce_as_placeholder_identifier_wrapped(TokenStack& tokenStack)
         {
             CTNP_ASSERT(is_suffix_of<Closing>(tokenStack), "Token-stack does not have the closing token as top.", tokenStack);
-            std::span pendingTokens{tokenStack.begin(), tokenStack.end() - 1};
+            TokenStackView pendingTokens{tokenStack};
+            remove_suffix(pendingTokens, 1u);
+
+            std::optional const openingIndex = tokenStack.find_last_bracket<Opening>(pendingTokens.size());
+            if (!openingIndex)
+            {
+                return false;
+            }
 
-            auto const openingIter = std::ranges::find_if(
-                pendingTokens | std::views::reverse,
-                [](Token const& token) noexcept { return std::holds_alternative<Opening>(token); });
-            if (openingIter == pendingTokens.rend()
-                || !is_identifier_prefix({pendingTokens.begin(), openingIter.base() - 1}))
+            if (!is_identifier_prefix(pendingTokens.first(*openingIndex)))
             {
                 return false;
             }
 
             // Just treat everything between the opening and closing as placeholder identifier.
-            auto const& opening = std::get<Opening>(*std::ranges::prev(openingIter.base(), 1));
+            auto const& opening = std::get<Opening>(pendingTokens.tokens()[*openingIndex]);
             auto const& closing = std::get<Closing>(tokenStack.back());
             auto const contentLength = (closing.content.data() - opening.content.data()) + closing.content.size();
             std::string_view const content{opening.content.data(), contentLength};
 
-            pendingTokens = std::span{pendingTokens.begin(), openingIter.base() - 1};
+            pendingTokens = pendingTokens.first(*openingIndex);
 
             // There may be a space in front of the placeholder, which isn't necessary.
             ignore_space(pendingTokens);
 
-            tokenStack.resize(pendingTokens.size() + 1u);
-            tokenStack.back() = Identifier{.content = content};
+            tokenStack.truncate(pendingTokens.size());
+            tokenStack.emplace_back(
+                Identifier{
+                    .flags = lexing::token::Identifier::classify(content),
+                    .content = content});
 
             return true;
         }
 
         inline bool try_reduce_as_function_type(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
 
             auto* const ctx = match_suffix<FunctionContext>(pendingTokens);
             if (!ctx)
@@ -386,19 +411,20 @@ namespace ctnp::parsing
             remove_suffix(pendingTokens, 1u);
 
             FunctionType funType{
-                .returnType = std::make_shared<Type>(std::move(*returnType)),
+                .returnType = Box<Type>::make(std::move(*returnType)),
                 .context = std::move(*ctx)};
 
-            tokenStack.resize(
-                std::exchange(pendingTokens, {}).size() + 1u);
-            tokenStack.back().emplace<Type>(std::move(funType));
+            tokenStack.truncate(pendingTokens.size());
+            tokenStack.emplace_back(
+                std::in_place_type<Type>,
+                std::move(funType));
 
             return true;
         }
 
         inline bool try_reduce_as_function_ptr(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             if (!is_suffix_of<ClosingParens>(pendingTokens))
             {
                 return false;
@@ -487,13 +513,13 @@ namespace ctnp::parsing
 
                 if (nestedFunPtr)
                 {
-                    nested.ptr = std::make_shared<FunctionPtr>(std::move(*nestedFunPtr));
+                    nested.ptr = Box<FunctionPtr>::make(std::move(*nestedFunPtr));
                 }
 
                 funPtr.nested = std::move(nested);
             }
 
-            tokenStack.resize(pendingTokens.size());
+            tokenStack.truncate(pendingTokens.size());
             tokenStack.emplace_back(std::move(funPtr));
 
             return true;
@@ -506,7 +532,7 @@ namespace ctnp::parsing
 
         inline bool try_reduce_as_function_ptr_type(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
 
             // Ignore something like `__ptr64`.
             ignore_reserved_identifier(pendingTokens);
@@ -519,14 +545,15 @@ namespace ctnp::parsing
 
                 std::optional nestedInfo = std::move(ptr.nested);
                 FunctionPtrType ptrType{
-                    .returnType = std::make_shared<Type>(std::move(returnType)),
+                    .returnType = Box<Type>::make(std::move(returnType)),
                     .scopes = std::move(ptr.scopes),
                     .specs = std::move(ptr.specs),
                     .context = std::move(ctx)};
 
-                tokenStack.resize(
-                    std::exchange(pendingTokens, {}).size() + 1u);
-                tokenStack.back().emplace<Type>(std::move(ptrType));
+                tokenStack.truncate(pendingTokens.size());
+                tokenStack.emplace_back(
+                    std::in_place_type<Type>,
+                    std::move(ptrType));
 
                 // We got something like `ret (*(outer-args))(args)` or `ret (*(*)(outer-args))(args)`, where the currently
                 // processed function-ptr is actually the return-type of the inner function(-ptr).
@@ -572,7 +599,7 @@ namespace ctnp::parsing
 
         inline bool try_reduce_as_regular_type(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             auto* const identifier = match_suffix<Identifier>(pendingTokens);
             if (!identifier)
             {
@@ -600,10 +627,9 @@ namespace ctnp::parsing
             if (prefixSpecs)
             {
                 // Prefix-specs can only have `const` and/or `volatile`.
-                if (auto const& layers = prefixSpecs->layers;
-                    token::Specs::Refness::none != prefixSpecs->refness
+                if (token::Specs::Refness::none != prefixSpecs->refness
                     || prefixSpecs->isNoexcept
-                    || 1u != layers.size())
+                    || prefixSpecs->has_ptr())
                 {
                     return false;
                 }
@@ -635,7 +661,7 @@ namespace ctnp::parsing
                 remove_suffix(pendingTokens, 1u);
             }
 
-            tokenStack.resize(pendingTokens.size());
+            tokenStack.truncate(pendingTokens.size());
             tokenStack.emplace_back(
                 std::in_place_type<Type>,
                 std::move(newType));
@@ -652,7 +678,7 @@ namespace ctnp::parsing
 
         inline bool try_reduce_as_function(TokenStack& tokenStack)
         {
-            std::span pendingTokens{tokenStack};
+            TokenStackView pendingTokens{tokenStack};
             if (auto* funIdentifier = match_suffix<FunctionIdentifier>(pendingTokens))
             {
                 Function function{
@@ -670,12 +696,11 @@ namespace ctnp::parsing
 
                 if (auto* returnType = match_suffix<Type>(pendingTokens))
                 {
-                    function.returnType = std::make_shared<Type>(std::move(*returnType));
+                    function.returnType = Box<Type>::make(std::move(*returnType));
                     remove_suffix(pendingTokens, 1u);
                 }
 
-                tokenStack.resize(
-                    std::exchange(pendingTokens, {}).size());
+                tokenStack.truncate(pendingTokens.size());
                 tokenStack.emplace_back(std::move(function));
 
                 return true;
@@ -697,13 +722,14 @@ namespace ctnp::parsing
 
             try_reduce_as_type(tokenStack);
             CTNP_ASSERT(is_suffix_of<Type>(tokenStack), "Invalid state", tokenStack);
-            auto targetType = std::make_shared<Type>(
-                std::get<Type>(std::move(tokenStack.back())));
+            auto targetType = Box<Type>::make(std::get<Type>(std::move(tokenStack.back())));
             tokenStack.pop_back();
 
             CTNP_ASSERT(is_suffix_of<OperatorKeyword>(tokenStack), "Invalid state", tokenStack);
-            tokenStack.back() = Identifier{
-                .content = Identifier::OperatorInfo{.symbol = std::move(targetType)}};
+            tokenStack.pop_back();
+            tokenStack.emplace_back(
+                Identifier{
+                    .content = Identifier::OperatorInfo{.symbol = std::move(targetType)}});
 
             if (funCtx)
             {
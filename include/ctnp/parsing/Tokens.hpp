@@ -7,12 +7,19 @@
 #define CTNP_PARSING_TOKENS_HPP
 
 #include "ctnp/config/Config.hpp"
+#include "ctnp/lexing/Tokens.hpp"
+#include "ctnp/parsing/Allocator.hpp"
+#include "ctnp/parsing/Box.hpp"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <memory>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string_view>
 #include <type_traits>
 #include <variant>
@@ -61,6 +68,28 @@ namespace ctnp::parsing
                                  visitor.end_operator_identifier();
                              };
 
+    /**
+     * \brief Determines, whether the visitor additionally accepts the identifier flags.
+     * \details Such visitors receive the already determined `lexing::token::Identifier` flags for each plain
+     * identifier and thus do not need to inspect the content again.
+     */
+    template <typename T>
+    concept identifier_flags_visitor = requires(T visitor, std::string_view content, std::uint8_t flags) {
+        visitor.add_identifier(content, flags);
+    };
+
+    /**
+     * \brief Determines, whether the visitor discards the content of template-args.
+     * \details Visitors opt in by stating `static constexpr bool needsTemplateArgs{false};`.
+     * For such visitors, the parser just matches the brackets of each template-arg list and counts the args, instead of
+     * actually parsing them. Thus, these visitors receive `begin_template_args` (with the actual count) and
+     * `end_template_args`, but nothing in between.
+     */
+    template <typename T>
+    concept template_args_discarding_visitor = requires {
+        requires !std::remove_cvref_t<std::unwrap_reference_t<T>>::needsTemplateArgs;
+    };
+
     template <parser_visitor Visitor>
     [[nodiscard]]
     constexpr auto& unwrap_visitor(Visitor& visitor) noexcept
@@ -99,6 +128,9 @@ namespace ctnp::parsing::token
     {
     public:
         std::string_view content;
+
+        // The number of flushed events, when this token has been shifted (see `ArgSequence::Flushed`).
+        std::uint32_t flushMark{};
     };
 
     class ClosingAngle
@@ -174,7 +206,11 @@ namespace ctnp::parsing::token
             }
         };
 
-        std::vector<Layer> layers{1u};
+        /**
+         * \brief The number of layers, which are stored in place.
+         * \details Only deeper layers are spilled to the heap.
+         */
+        static constexpr std::size_t inlineLayers{16u};
 
         enum Refness : std::uint8_t
         {
@@ -187,24 +223,83 @@ namespace ctnp::parsing::token
         bool isNoexcept{false};
 
         [[nodiscard]]
-        CTNP_DETAIL_CONSTEXPR_VECTOR bool has_ptr() const noexcept
+        constexpr std::size_t layer_count() const noexcept
+        {
+            return m_LayerCount;
+        }
+
+        [[nodiscard]]
+        constexpr bool has_ptr() const noexcept
+        {
+            return 1u < m_LayerCount;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Layer layer(std::size_t const index) const noexcept
+        {
+            CTNP_ASSERT(index < m_LayerCount, "Index out of bounds.");
+
+            if (index < inlineLayers)
+            {
+                std::uint32_t const bits = m_InlineBits >> (bitsPerLayer * index);
+
+                return Layer{
+                    .isConst = 0u != (bits & constBit),
+                    .isVolatile = 0u != (bits & volatileBit)};
+            }
+
+            return m_SpilledLayers[index - inlineLayers];
+        }
+
+        /**
+         * \brief Returns the innermost layer, which receives all subsequent qualifications.
+         */
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Layer top() const noexcept
+        {
+            return layer(m_LayerCount - 1u);
+        }
+
+        /**
+         * \brief Qualifies the innermost layer as `const`.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void add_const() noexcept
         {
-            return 1u < layers.size();
+            qualify_top(constBit);
+        }
+
+        /**
+         * \brief Qualifies the innermost layer as `volatile`.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void add_volatile() noexcept
+        {
+            qualify_top(volatileBit);
+        }
+
+        /**
+         * \brief Adds a new unqualified pointer layer.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void add_ptr()
+        {
+            if (inlineLayers <= m_LayerCount)
+            {
+                m_SpilledLayers.emplace_back();
+            }
+
+            ++m_LayerCount;
         }
 
         template <parser_visitor Visitor>
         constexpr void operator()(Visitor& visitor) const
         {
-            CTNP_ASSERT(!layers.empty(), "Invalid state.");
-
             auto& unwrapped = unwrap_visitor(visitor);
 
-            std::invoke(layers.front(), unwrapped);
+            std::invoke(layer(0u), unwrapped);
 
-            for (auto const& layer : layers | std::views::drop(1u))
+            for (std::size_t i = 1u; i < m_LayerCount; ++i)
             {
                 unwrapped.add_ptr();
-                std::invoke(layer, unwrapped);
+                std::invoke(layer(i), unwrapped);
             }
 
             switch (refness)
@@ -226,12 +321,56 @@ namespace ctnp::parsing::token
                 unwrapped.add_noexcept();
             }
         }
+
+    private:
+        static constexpr std::size_t bitsPerLayer{2u};
+        static constexpr std::uint32_t constBit{0b01u};
+        static constexpr std::uint32_t volatileBit{0b10u};
+
+        static_assert(inlineLayers * bitsPerLayer <= 32u, "Inline layers exceed the available bits.");
+
+        // Two bits per layer, starting with the outermost one at the lowest bits.
+        std::uint32_t m_InlineBits{};
+        std::uint32_t m_LayerCount{1u};
+        std::vector<Layer, Allocator<Layer>> m_SpilledLayers{};
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR void qualify_top(std::uint32_t const bit) noexcept
+        {
+            if (std::size_t const index = m_LayerCount - 1u;
+                index < inlineLayers)
+            {
+                m_InlineBits |= bit << (bitsPerLayer * index);
+            }
+            else
+            {
+                Layer& layer = m_SpilledLayers.back();
+                layer.isConst = layer.isConst || constBit == bit;
+                layer.isVolatile = layer.isVolatile || volatileBit == bit;
+            }
+        }
     };
 
     class ArgSequence
     {
     public:
-        std::vector<Type> types;
+        std::vector<Type, Allocator<Type>> types;
+
+        // The number of args, whose content has been skipped (see `template_args_discarding_visitor`).
+        std::size_t skipped{0u};
+
+        /**
+         * \brief Denotes args, whose events have already been flushed into an external node-sequence.
+         * \details Flushed args are no longer stored as types. Thus, they can only be visited via `Traversal`, which
+         * receives the flushed node-sequence.
+         */
+        struct Flushed
+        {
+            std::uint32_t offset{};
+            std::uint32_t size{};
+            std::uint32_t count{};
+        };
+
+        std::optional<Flushed> flushed{};
 
         CTNP_DETAIL_CONSTEXPR_VECTOR ~ArgSequence() noexcept;
         CTNP_DETAIL_CONSTEXPR_VECTOR ArgSequence();
@@ -240,6 +379,14 @@ namespace ctnp::parsing::token
         CTNP_DETAIL_CONSTEXPR_VECTOR ArgSequence(ArgSequence&&) noexcept;
         CTNP_DETAIL_CONSTEXPR_VECTOR ArgSequence& operator=(ArgSequence&&) noexcept;
 
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::size_t count() const noexcept
+        {
+            return types.size()
+                 + skipped
+                 + (flushed ? flushed->count : 0u);
+        }
+
         template <parser_visitor Visitor>
         CTNP_DETAIL_CONSTEXPR_VECTOR void operator()(Visitor& visitor) const;
 
@@ -250,11 +397,14 @@ namespace ctnp::parsing::token
     class Identifier
     {
     public:
-        bool isBuiltinType{false};
+        using Flag = lexing::token::Identifier::Flag;
+
+        // See `lexing::token::Identifier::Flag`. Operator identifiers never have any flags set.
+        std::uint8_t flags{Flag::none};
 
         struct OperatorInfo
         {
-            using Symbol = std::variant<std::string_view, std::shared_ptr<Type>>;
+            using Symbol = std::variant<std::string_view, Box<Type>>;
             Symbol symbol{};
         };
 
@@ -271,25 +421,21 @@ namespace ctnp::parsing::token
         [[nodiscard]]
         constexpr bool is_void() const noexcept
         {
-            auto const* const id = std::get_if<std::string_view>(&content);
-
-            return id
-                && "void" == *id;
+            // `void` is a keyword, thus it's always a builtin.
+            return is_builtin()
+                && "void" == std::get<std::string_view>(content);
         }
 
         [[nodiscard]]
         constexpr bool is_reserved() const noexcept
         {
-            auto const* const id = std::get_if<std::string_view>(&content);
-
-            return id
-                && id->starts_with("__");
+            return 0u != (flags & Flag::reserved);
         }
 
         [[nodiscard]]
         constexpr bool is_builtin() const noexcept
         {
-            return isBuiltinType;
+            return 0u != (flags & Flag::builtin);
         }
 
         template <parser_visitor Visitor>
@@ -298,7 +444,7 @@ namespace ctnp::parsing::token
             auto& unwrapped = unwrap_visitor(visitor);
 
             std::visit(
-                [&](auto const& inner) { handle_content(unwrapped, inner); },
+                [&](auto const& inner) { handle_content(unwrapped, inner, flags); },
                 content);
 
             if (templateArgs)
@@ -309,15 +455,22 @@ namespace ctnp::parsing::token
 
     public:
         template <parser_visitor Visitor>
-        static constexpr void handle_content(Visitor& visitor, std::string_view const& content)
+        static constexpr void handle_content(Visitor& visitor, std::string_view const& content, std::uint8_t const flags)
         {
             CTNP_ASSERT(!content.empty(), "Empty identifier is not allowed.");
 
-            visitor.add_identifier(content);
+            if constexpr (identifier_flags_visitor<Visitor&>)
+            {
+                visitor.add_identifier(content, flags);
+            }
+            else
+            {
+                visitor.add_identifier(content);
+            }
         }
 
         template <parser_visitor Visitor>
-        static constexpr void handle_content(Visitor& visitor, OperatorInfo const& content)
+        static constexpr void handle_content(Visitor& visitor, OperatorInfo const& content, [[maybe_unused]] std::uint8_t const flags)
         {
             visitor.begin_operator_identifier();
             std::visit(
@@ -331,11 +484,18 @@ namespace ctnp::parsing::token
         {
             CTNP_ASSERT(!symbol.empty(), "Empty symbol is not allowed.");
 
-            visitor.add_identifier(symbol);
+            if constexpr (identifier_flags_visitor<Visitor&>)
+            {
+                visitor.add_identifier(symbol, std::uint8_t{Flag::none});
+            }
+            else
+            {
+                visitor.add_identifier(symbol);
+            }
         }
 
         template <parser_visitor Visitor>
-        static constexpr void handle_op_symbol(Visitor& visitor, std::shared_ptr<Type> const& type)
+        static constexpr void handle_op_symbol(Visitor& visitor, Box<Type> const& type)
         {
             CTNP_ASSERT(type, "Empty type-symbol is not allowed.");
 
@@ -373,7 +533,7 @@ namespace ctnp::parsing::token
     {
     public:
         using Scope = std::variant<Identifier, FunctionIdentifier>;
-        std::vector<Scope> scopes{};
+        std::vector<Scope, Allocator<Scope>> scopes{};
 
         template <parser_visitor Visitor>
         constexpr void operator()(Visitor& visitor) const
@@ -437,7 +597,7 @@ namespace ctnp::parsing::token
     class FunctionType
     {
     public:
-        std::shared_ptr<Type> returnType{};
+        Box<Type> returnType{};
         FunctionContext context{};
 
         template <parser_visitor Visitor>
@@ -467,7 +627,7 @@ namespace ctnp::parsing::token
 
         struct NestedInfo
         {
-            std::shared_ptr<FunctionPtr> ptr{};
+            Box<FunctionPtr> ptr{};
             FunctionContext ctx{};
         };
 
@@ -477,7 +637,7 @@ namespace ctnp::parsing::token
     class FunctionPtrType
     {
     public:
-        std::shared_ptr<Type> returnType{};
+        Box<Type> returnType{};
         std::optional<ScopeSequence> scopes{};
         Specs specs{};
         FunctionContext context{};
@@ -573,6 +733,8 @@ namespace ctnp::parsing::token
     template <parser_visitor Visitor>
     CTNP_DETAIL_CONSTEXPR_VECTOR void ArgSequence::operator()(Visitor& visitor) const
     {
+        CTNP_ASSERT(!flushed, "Flushed args can only be visited via a Traversal.");
+
         if (!types.empty())
         {
             auto& unwrapped = unwrap_visitor(visitor);
@@ -592,7 +754,7 @@ namespace ctnp::parsing::token
     {
         auto& unwrapped = unwrap_visitor(visitor);
 
-        unwrapped.begin_template_args(std::ranges::ssize(types));
+        unwrapped.begin_template_args(static_cast<std::ptrdiff_t>(count()));
         std::invoke(*this, unwrapped);
         unwrapped.end_template_args();
     }
@@ -611,7 +773,7 @@ namespace ctnp::parsing::token
     class Function
     {
     public:
-        std::shared_ptr<Type> returnType{};
+        Box<Type> returnType{};
         std::optional<ScopeSequence> scopes{};
         FunctionIdentifier identifier{};
 
@@ -667,12 +829,308 @@ namespace ctnp::parsing
         token::Specs,
         token::Type,
         token::Function>;
-    using TokenStack = std::vector<Token>;
 
     template <typename T>
     concept token_type = requires(Token const& token) {
         { std::holds_alternative<Token>(token) } -> std::convertible_to<bool>;
     };
+
+    namespace detail
+    {
+        /**
+         * \brief Determines the kind (i.e. the alternative index) of the given token-type.
+         */
+        template <token_type T>
+        [[nodiscard]]
+        consteval std::uint8_t token_kind() noexcept
+        {
+            return lexing::detail::token_kind<T>(std::type_identity<Token>{});
+        }
+    }
+
+    /**
+     * \brief Stack of parser tokens, which additionally maintains the kind of each token in a compact byte-array.
+     * \details This way, suffix-checks just compare a few adjacent bytes, instead of inspecting each variant.
+     *
+     * Furthermore, the positions of all bracket-like tokens (i.e. tokens, which may open a placeholder) are tracked
+     * per kind, so that the innermost opening bracket is found in constant time.
+     * \attention The alternative of a stored token must not be changed via the returned references.
+     * Replace the token instead (e.g. via `pop_back` and `emplace_back`).
+     */
+    class TokenStack
+    {
+    public:
+        using Kind = std::uint8_t;
+        using TokenSequence = std::vector<Token, Allocator<Token>>;
+        using const_iterator = TokenSequence::const_iterator;
+
+        [[nodiscard]]
+        TokenStack() = default;
+
+        [[nodiscard]]
+        explicit TokenStack(Allocator<Token> const& allocator) noexcept
+            : m_Tokens{allocator},
+              m_Kinds{Allocator<Kind>{allocator}},
+              m_Brackets{
+                  BracketPositions{Allocator<std::size_t>{allocator}},
+                  BracketPositions{Allocator<std::size_t>{allocator}},
+                  BracketPositions{Allocator<std::size_t>{allocator}},
+                  BracketPositions{Allocator<std::size_t>{allocator}},
+                  BracketPositions{Allocator<std::size_t>{allocator}}}
+        {
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::size_t size() const noexcept
+        {
+            return m_Tokens.size();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR bool empty() const noexcept
+        {
+            return m_Tokens.empty();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Token* data() noexcept
+        {
+            return m_Tokens.data();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Token const* data() const noexcept
+        {
+            return m_Tokens.data();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::span<Kind const> kinds() const noexcept
+        {
+            return m_Kinds;
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR const_iterator cbegin() const noexcept
+        {
+            return m_Tokens.cbegin();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR const_iterator cend() const noexcept
+        {
+            return m_Tokens.cend();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Token& back() noexcept
+        {
+            CTNP_ASSERT(!empty(), "Token-stack is empty.");
+
+            return m_Tokens.back();
+        }
+
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR Token const& back() const noexcept
+        {
+            CTNP_ASSERT(!empty(), "Token-stack is empty.");
+
+            return m_Tokens.back();
+        }
+
+        /**
+         * \brief Determines the position of the topmost bracket of the given kind, which is below the given position.
+         * \tparam Bracket The bracket-kind. Must be one of `OpeningAngle`, `OpeningParens`, `OpeningCurly`,
+         * `OpeningBacktick` or `ClosingSingleQuote`.
+         * \return The position, if there is such a bracket.
+         */
+        template <token_type Bracket>
+        [[nodiscard]]
+        CTNP_DETAIL_CONSTEXPR_VECTOR std::optional<std::size_t> find_last_bracket(std::size_t const end) const noexcept
+        {
+            constexpr std::size_t slot = bracket_slot(detail::token_kind<Bracket>());
+            static_assert(slot < bracketKinds.size(), "Bracket is not a tracked kind.");
+
+            // As all positions are unique, just the top two entries can be equal to or greater than `end`,
+            // when `end` denotes the topmost token.
+            auto const& positions = m_Brackets[slot];
+            for (auto iter = positions.crbegin(); iter != positions.crend(); ++iter)
+            {
+                if (*iter < end)
+                {
+                    return *iter;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        template <typename... Args>
+        CTNP_DETAIL_CONSTEXPR_VECTOR Token& emplace_back(Args&&... args)
+        {
+            Token& token = m_Tokens.emplace_back(std::forward<Args>(args)...);
+            auto const kind = static_cast<Kind>(token.index());
+            m_Kinds.emplace_back(kind);
+
+            if (std::size_t const slot = bracket_slot(kind);
+                slot < bracketKinds.size())
+            {
+                m_Brackets[slot].emplace_back(m_Tokens.size() - 1u);
+            }
+
+            return token;
+        }
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR void pop_back() noexcept
+        {
+            CTNP_ASSERT(!empty(), "Token-stack is empty.");
+
+            truncate(size() - 1u);
+        }
+
+        /**
+         * \brief Shrinks the stack to the given number of tokens.
+         */
+        CTNP_DETAIL_CONSTEXPR_VECTOR void truncate(std::size_t const count) noexcept
+        {
+            CTNP_ASSERT(count <= size(), "Count exceeds stack size.");
+
+            m_Tokens.erase(m_Tokens.cbegin() + static_cast<std::ptrdiff_t>(count), m_Tokens.cend());
+            m_Kinds.resize(count);
+
+            // Each position is removed at most once, thus this is amortized constant.
+            for (auto& positions : m_Brackets)
+            {
+                while (!positions.empty()
+                       && count <= positions.back())
+                {
+                    positions.pop_back();
+                }
+            }
+        }
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR const_iterator erase(const_iterator const pos)
+        {
+            auto const index = static_cast<std::size_t>(pos - m_Tokens.cbegin());
+            m_Kinds.erase(m_Kinds.cbegin() + static_cast<std::ptrdiff_t>(index));
+
+            for (auto& positions : m_Brackets)
+            {
+                std::erase(positions, index);
+                for (std::size_t& position : positions | std::views::reverse)
+                {
+                    if (position < index)
+                    {
+                        break;
+                    }
+
+                    --position;
+                }
+            }
+
+            return m_Tokens.erase(pos);
+        }
+
+        CTNP_DETAIL_CONSTEXPR_VECTOR void clear() noexcept
+        {
+            m_Tokens.clear();
+            m_Kinds.clear();
+
+            for (auto& positions : m_Brackets)
+            {
+                positions.clear();
+            }
+        }
+
+    private:
+        static constexpr std::array bracketKinds{
+            detail::token_kind<token::OpeningAngle>(),
+            detail::token_kind<token::OpeningParens>(),
+            detail::token_kind<token::OpeningCurly>(),
+            detail::token_kind<token::OpeningBacktick>(),
+            detail::token_kind<token::ClosingSingleQuote>()};
+
+        using BracketPositions = std::vector<std::size_t, Allocator<std::size_t>>;
+
+        TokenSequence m_Tokens{};
+        std::vector<Kind, Allocator<Kind>> m_Kinds{};
+        std::array<BracketPositions, bracketKinds.size()> m_Brackets{};
+
+        [[nodiscard]]
+        static constexpr std::size_t bracket_slot(Kind const kind) noexcept
+        {
+            return static_cast<std::size_t>(
+                std::ranges::distance(bracketKinds.cbegin(), std::ranges::find(bracketKinds, kind)));
+        }
+    };
+
+    /**
+     * \brief Mutable view onto the bottom part of a `TokenStack`, including the kinds of the viewed tokens.
+     */
+    class TokenStackView
+    {
+    public:
+        using Kind = TokenStack::Kind;
+
+        [[nodiscard]]
+        explicit(false) CTNP_DETAIL_CONSTEXPR_VECTOR TokenStackView(TokenStack& stack) noexcept
+            : m_Tokens{stack.data()},
+              m_Kinds{stack.kinds().data()},
+              m_Size{stack.size()}
+        {
+        }
+
+        [[nodiscard]]
+        constexpr std::size_t size() const noexcept
+        {
+            return m_Size;
+        }
+
+        [[nodiscard]]
+        constexpr bool empty() const noexcept
+        {
+            return 0u == m_Size;
+        }
+
+        [[nodiscard]]
+        constexpr std::span<Token> tokens() const noexcept
+        {
+            return {m_Tokens, m_Size};
+        }
+
+        [[nodiscard]]
+        constexpr std::span<Kind const> kinds() const noexcept
+        {
+            return {m_Kinds, m_Size};
+        }
+
+        [[nodiscard]]
+        constexpr Token& back() const noexcept
+        {
+            CTNP_ASSERT(!empty(), "View is empty.");
+
+            return m_Tokens[m_Size - 1u];
+        }
+
+        /**
+         * \brief Returns the view of the first `count` tokens.
+         */
+        [[nodiscard]]
+        constexpr TokenStackView first(std::size_t const count) const noexcept
+        {
+            CTNP_ASSERT(count <= m_Size, "Count exceeds view size.");
+
+            TokenStackView view{*this};
+            view.m_Size = count;
+
+            return view;
+        }
+
+    private:
+        Token* m_Tokens;
+        Kind const* m_Kinds;
+        std::size_t m_Size;
+    };
 }
 
 #endif
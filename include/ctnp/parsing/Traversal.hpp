@@ -0,0 +1,374 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CTNP_PARSING_TRAVERSAL_HPP
+#define CTNP_PARSING_TRAVERSAL_HPP
+
+#pragma once
+
+#include "ctnp/config/Config.hpp"
+#include "ctnp/parsing/Allocator.hpp"
+#include "ctnp/parsing/NodeTable.hpp"
+#include "ctnp/parsing/Tokens.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace ctnp::parsing
+{
+    /**
+     * \brief Visits token-trees by an explicit work-stack, instead of native recursion.
+     * \details The call-operators of the tokens recurse once per nesting level (e.g. a type, its template-args, their
+     * types, and so on), which may exhaust small native stacks for deeply nested names.
+     * The traversal instead keeps all pending steps on a heap-allocated stack. Each step is either a single visitor
+     * callback or a not yet expanded subtree. Expanding a subtree schedules its parts in reverse order, thus they
+     * are popped in visitation order again.
+     *
+     * Regardless of the nesting depth, the native stack usage is bounded, while the visitor receives exactly the same
+     * callback sequence as from the recursive call-operators.
+     * The capacity of the work-stack is kept across subsequent traversals.
+     *
+     * Args, which have already been flushed (see `token::ArgSequence::Flushed`), are spliced from the given flushed
+     * node-sequence.
+     */
+    class Traversal
+    {
+    public:
+        /**
+         * \brief Denotes the optional return-type of a function or function-ptr.
+         */
+        struct ReturnType
+        {
+            token::Type const* type;
+        };
+
+        /**
+         * \brief Denotes the optional template-args of an identifier.
+         */
+        struct TemplateArgs
+        {
+            token::ArgSequence const* args;
+        };
+
+        using Step = std::variant<
+            Node,
+            ReturnType,
+            TemplateArgs,
+            token::ArgSequence::Flushed,
+            token::Type const*,
+            token::Identifier const*,
+            token::Identifier::OperatorInfo const*,
+            token::ScopeSequence const*,
+            token::ArgSequence const*,
+            token::FunctionIdentifier const*,
+            token::FunctionContext const*,
+            token::Specs const*>;
+
+        [[nodiscard]]
+        Traversal() = default;
+
+        [[nodiscard]]
+        explicit Traversal(std::pmr::memory_resource& resource) noexcept
+            : m_Steps{Allocator<Step>{resource}}
+        {
+        }
+
+        template <parser_visitor Visitor>
+        void operator()(token::Type const& type, Visitor& visitor, std::span<Node const> const flushed = {})
+        {
+            m_Steps.clear();
+            m_Flushed = flushed;
+            expand(type);
+            drain(unwrap_visitor(visitor));
+        }
+
+        template <parser_visitor Visitor>
+        void operator()(token::ArgSequence const& args, Visitor& visitor, std::span<Node const> const flushed = {})
+        {
+            m_Steps.clear();
+            m_Flushed = flushed;
+            expand(&args);
+            drain(unwrap_visitor(visitor));
+        }
+
+        template <parser_visitor Visitor>
+        void operator()(token::Function const& function, Visitor& visitor, std::span<Node const> const flushed = {})
+        {
+            m_Steps.clear();
+            m_Flushed = flushed;
+            schedule(
+                event(Node::beginFunction),
+                ReturnType{function.returnType.get()},
+                address_of(function.scopes),
+                &function.identifier,
+                event(Node::endFunction));
+            drain(unwrap_visitor(visitor));
+        }
+
+    private:
+        std::vector<Step, Allocator<Step>> m_Steps{};
+        std::span<Node const> m_Flushed{};
+
+        [[nodiscard]]
+        static constexpr Node event(Node::Kind const kind, std::size_t const count = 0u) noexcept
+        {
+            return Node{.count = static_cast<std::uint32_t>(count), .kind = kind};
+        }
+
+        [[nodiscard]]
+        static constexpr Node identifier_event(std::string_view const content, std::uint8_t const flags) noexcept
+        {
+            CTNP_ASSERT(!content.empty(), "Empty identifier is not allowed.");
+
+            return Node{.content = content, .kind = Node::identifier, .flags = flags};
+        }
+
+        template <typename T>
+        [[nodiscard]]
+        static constexpr T const* address_of(std::optional<T> const& value) noexcept
+        {
+            return value ? &*value : nullptr;
+        }
+
+        /**
+         * \brief Schedules the given steps, so that the first one is popped next.
+         */
+        template <typename... Steps>
+        void schedule(Steps const&... steps)
+        {
+            std::array const sequence{Step{steps}...};
+            m_Steps.insert(m_Steps.cend(), sequence.crbegin(), sequence.crend());
+        }
+
+        template <typename Visitor>
+        void drain(Visitor& visitor)
+        {
+            while (!m_Steps.empty())
+            {
+                Step const step = m_Steps.back();
+                m_Steps.pop_back();
+
+                std::visit(
+                    [&](auto const& current) { process(visitor, current); },
+                    step);
+            }
+        }
+
+        template <typename Visitor>
+        static void process(Visitor& visitor, Node const& node)
+        {
+            detail::dispatch(visitor, node);
+        }
+
+        template <typename Visitor>
+        static void process(Visitor& visitor, token::Specs const* const specs)
+        {
+            CTNP_ASSERT(specs, "Specs are mandatory.");
+
+            std::invoke(*specs, visitor);
+        }
+
+        template <typename Visitor>
+        void process(Visitor& visitor, token::ArgSequence::Flushed const& flushed)
+        {
+            CTNP_ASSERT(flushed.offset + flushed.size <= m_Flushed.size(), "Flushed range is out of bounds.");
+
+            for (Node const& node : m_Flushed.subspan(flushed.offset, flushed.size))
+            {
+                detail::dispatch(visitor, node);
+            }
+        }
+
+        template <typename Visitor, typename T>
+        void process([[maybe_unused]] Visitor& visitor, T const& subtree)
+        {
+            expand(subtree);
+        }
+
+        void expand(ReturnType const& returnType)
+        {
+            if (returnType.type)
+            {
+                schedule(event(Node::beginReturnType), returnType.type, event(Node::endReturnType));
+            }
+        }
+
+        void expand(TemplateArgs const& templateArgs)
+        {
+            if (templateArgs.args)
+            {
+                schedule(
+                    event(Node::beginTemplateArgs, templateArgs.args->count()),
+                    templateArgs.args,
+                    event(Node::endTemplateArgs));
+            }
+        }
+
+        void expand(token::Type const* const type)
+        {
+            CTNP_ASSERT(type, "Type is mandatory.");
+
+            expand(*type);
+        }
+
+        void expand(token::Type const& type)
+        {
+            std::visit(
+                [&](auto const& inner) { expand(inner); },
+                type.state);
+        }
+
+        void expand(token::RegularType const& type)
+        {
+            schedule(
+                event(Node::beginType),
+                address_of(type.scopes),
+                &type.identifier,
+                &type.specs,
+                event(Node::endType));
+        }
+
+        void expand(token::FunctionType const& type)
+        {
+            CTNP_ASSERT(type.returnType, "Return type is mandatory for function-types.");
+
+            schedule(
+                event(Node::beginFunction),
+                ReturnType{type.returnType.get()},
+                &type.context,
+                event(Node::endFunction));
+        }
+
+        void expand(token::FunctionPtrType const& type)
+        {
+            CTNP_ASSERT(type.returnType, "Return type is mandatory for function-ptrs.");
+
+            schedule(
+                event(Node::beginType),
+                ReturnType{type.returnType.get()},
+                event(Node::beginFunctionPtr),
+                address_of(type.scopes),
+                &type.specs,
+                event(Node::endFunctionPtr),
+                &type.context,
+                event(Node::endType));
+        }
+
+        void expand(token::Identifier const* const identifier)
+        {
+            CTNP_ASSERT(identifier, "Identifier is mandatory.");
+
+            TemplateArgs const templateArgs{address_of(identifier->templateArgs)};
+            if (auto const* const content = std::get_if<std::string_view>(&identifier->content))
+            {
+                schedule(identifier_event(*content, identifier->flags), templateArgs);
+            }
+            else
+            {
+                schedule(&std::get<token::Identifier::OperatorInfo>(identifier->content), templateArgs);
+            }
+        }
+
+        void expand(token::Identifier::OperatorInfo const* const info)
+        {
+            if (auto const* const symbol = std::get_if<std::string_view>(&info->symbol))
+            {
+                schedule(
+                    event(Node::beginOperatorIdentifier),
+                    identifier_event(*symbol, std::uint8_t{token::Identifier::Flag::none}),
+                    event(Node::endOperatorIdentifier));
+            }
+            else
+            {
+                auto const& type = std::get<Box<token::Type>>(info->symbol);
+                CTNP_ASSERT(type, "Empty type-symbol is not allowed.");
+
+                schedule(
+                    event(Node::beginOperatorIdentifier),
+                    type.get(),
+                    event(Node::endOperatorIdentifier));
+            }
+        }
+
+        void expand(token::ScopeSequence const* const scopes)
+        {
+            if (!scopes)
+            {
+                return;
+            }
+
+            CTNP_ASSERT(!scopes->scopes.empty(), "Empty scope-sequence is not allowed.");
+
+            // Each scope is scheduled on top of its successors, thus the sequence must be processed in reverse.
+            for (auto const& scope : scopes->scopes | std::views::reverse)
+            {
+                if (auto const* const id = std::get_if<token::Identifier>(&scope))
+                {
+                    schedule(event(Node::beginScope), id, event(Node::endScope));
+                }
+                else
+                {
+                    schedule(
+                        event(Node::beginScope),
+                        event(Node::beginFunction),
+                        &std::get<token::FunctionIdentifier>(scope),
+                        event(Node::endFunction),
+                        event(Node::endScope));
+                }
+            }
+        }
+
+        void expand(token::ArgSequence const* const args)
+        {
+            CTNP_ASSERT(args, "Args are mandatory.");
+
+            if (args->flushed)
+            {
+                CTNP_ASSERT(args->types.empty(), "Flushed args must not have any types.");
+
+                schedule(*args->flushed);
+            }
+
+            auto const& types = args->types;
+            for (std::size_t i = types.size(); 0u < i; --i)
+            {
+                m_Steps.emplace_back(&types[i - 1u]);
+                if (1u < i)
+                {
+                    m_Steps.emplace_back(event(Node::arg));
+                }
+            }
+        }
+
+        void expand(token::FunctionIdentifier const* const identifier)
+        {
+            CTNP_ASSERT(identifier, "Function-identifier is mandatory.");
+
+            schedule(&identifier->identifier, &identifier->context);
+        }
+
+        void expand(token::FunctionContext const* const context)
+        {
+            CTNP_ASSERT(context, "Function-context is mandatory.");
+
+            schedule(
+                event(Node::beginFunctionArgs, context->args.types.size()),
+                &context->args,
+                event(Node::endFunctionArgs),
+                &context->specs);
+        }
+    };
+}
+
+#endif
@@ -9,7 +9,9 @@
 #include "ctnp/parsing/Reductions.hpp"
 #include "ctnp/parsing/Tokens.hpp"
 
+#include <algorithm>
 #include <array>
+#include <concepts>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -46,43 +48,79 @@ namespace ctnp::parsing::detail
         constexpr lexing::token::Keyword volatileKeyword{"volatile"};
         constexpr lexing::token::Keyword noexceptKeyword{"noexcept"};
         constexpr lexing::token::Keyword coAwaitKeyword{"co_await"};
-        constexpr lexing::token::Keyword newKeyword{"new"};
-        constexpr lexing::token::Keyword deleteKeyword{"delete"};
-        constexpr lexing::token::Keyword classKeyword{"class"};
-        constexpr lexing::token::Keyword structKeyword{"struct"};
-        constexpr lexing::token::Keyword enumKeyword{"enum"};
-
-        constexpr std::array typeKeywordCollection = {
-            lexing::token::Keyword{"auto"},
-            lexing::token::Keyword{"void"},
-            lexing::token::Keyword{"bool"},
-            lexing::token::Keyword{"char"},
-            lexing::token::Keyword{"char8_t"},
-            lexing::token::Keyword{"char16_t"},
-            lexing::token::Keyword{"char32_t"},
-            lexing::token::Keyword{"wchar_t"},
-            lexing::token::Keyword{"double"},
-            lexing::token::Keyword{"float"},
-            lexing::token::Keyword{"int"},
-            lexing::token::Keyword{"__int64"},
-            lexing::token::Keyword{"long"},
-            lexing::token::Keyword{"short"},
-            lexing::token::Keyword{"signed"},
-            lexing::token::Keyword{"unsigned"}};
     }
 
-    ParserImpl::ParserImpl(std::string_view const& content) noexcept
-        : m_Content{content},
-          m_Lexer{content}
+    ParserImpl::ParserImpl(std::string_view const& content, std::pmr::memory_resource* const resource) noexcept
+        : m_Resource{resource ? resource : &m_Arena},
+          m_Content{content},
+          m_Tokens{*m_Resource},
+          m_Checkpoints{Allocator<Checkpoint>{*m_Resource}},
+          m_TokenStack{Allocator<Token>{*m_Resource}},
+          m_Nodes{*m_Resource},
+          m_Flushed{*m_Resource},
+          m_FlushBuffer{*m_Resource},
+          m_Traversal{*m_Resource}
     {
     }
 
+    ParserImpl::ParserImpl(char const* const content, std::pmr::memory_resource* const resource) noexcept
+        : m_Resource{resource ? resource : &m_Arena},
+          m_TerminatedContent{content},
+          m_Tokens{*m_Resource},
+          m_Checkpoints{Allocator<Checkpoint>{*m_Resource}},
+          m_TokenStack{Allocator<Token>{*m_Resource}},
+          m_Nodes{*m_Resource},
+          m_Flushed{*m_Resource},
+          m_FlushBuffer{*m_Resource},
+          m_Traversal{*m_Resource}
+    {
+        CTNP_ASSERT(content, "Content must not be null.");
+    }
+
+    void ParserImpl::reset(std::string_view const& content) noexcept
+    {
+        reset(content, 0u);
+    }
+
+    void ParserImpl::reset(std::string_view const& content, std::size_t const sharedLength) noexcept
+    {
+        // Recorded checkpoints refer to the previous content, thus it must still be in place.
+        // The shared length accumulates over multiple resets, as the tokens are just updated by the next parse.
+        bool const isInPlace = !m_TerminatedContent
+                            && content.data() == m_Content.data();
+        m_SharedLength = isInPlace ? std::min({sharedLength, content.size(), m_SharedLength}) : 0u;
+
+        m_Content = content;
+        m_TerminatedContent = nullptr;
+        m_HasConversionOperator = false;
+        m_IsUnparseable = false;
+        m_TokenStack.clear();
+    }
+
+    void ParserImpl::reset(char const* const content) noexcept
+    {
+        CTNP_ASSERT(content, "Content must not be null.");
+
+        m_Content = {};
+        m_TerminatedContent = content;
+        m_SharedLength = 0u;
+        m_HasConversionOperator = false;
+        m_IsUnparseable = false;
+        m_TokenStack.clear();
+    }
+
     TypeResult ParserImpl::parse_type()
     {
+        ResourceScope const resourceScope{*m_Resource};
         parse();
-        token::try_reduce_as_type(m_TokenStack);
 
         TypeResult result{};
+        if (m_IsUnparseable)
+        {
+            return result;
+        }
+
+        token::try_reduce_as_type(m_TokenStack);
         if (auto* const end = match_suffix<token::Type>(m_TokenStack);
             end
             && 1u == m_TokenStack.size())
@@ -96,8 +134,14 @@ namespace ctnp::parsing::detail
 
     FunctionResult ParserImpl::parse_function()
     {
+        ResourceScope const resourceScope{*m_Resource};
         parse();
 
+        if (m_IsUnparseable)
+        {
+            return FunctionResult{};
+        }
+
         if (m_HasConversionOperator)
         {
             token::reduce_as_conversion_operator_function_identifier(m_TokenStack);
@@ -134,49 +178,587 @@ namespace ctnp::parsing::detail
         return result;
     }
 
+    NodeTable const& ParserImpl::parse_type_table()
+    {
+        m_FlushTemplateArgs = true;
+        TypeResult const result = parse_type();
+        m_FlushTemplateArgs = false;
+
+        ResourceScope const resourceScope{*m_Resource};
+        m_Nodes.clear();
+        NodeRecorder recorder{m_Nodes};
+        if (result)
+        {
+            recorder.begin();
+            m_Traversal(*result, recorder, m_Flushed.nodes());
+            recorder.end();
+        }
+        else
+        {
+            recorder.unrecognized(m_Content);
+        }
+
+        return m_Nodes;
+    }
+
+    NodeTable const& ParserImpl::parse_function_table()
+    {
+        std::ignore = parse_auto_table();
+
+        return m_Nodes;
+    }
+
+    NameKind ParserImpl::parse_auto_table()
+    {
+        m_FlushTemplateArgs = true;
+        FunctionResult const result = parse_function();
+        m_FlushTemplateArgs = false;
+
+        ResourceScope const resourceScope{*m_Resource};
+        m_Nodes.clear();
+        NodeRecorder recorder{m_Nodes};
+        std::visit(
+            [&]<typename Result>(Result const& inner) {
+                if constexpr (std::same_as<std::monostate, Result>)
+                {
+                    recorder.unrecognized(m_Content);
+                }
+                else
+                {
+                    recorder.begin();
+                    m_Traversal(inner, recorder, m_Flushed.nodes());
+                    recorder.end();
+                }
+            },
+            result);
+
+        if (std::holds_alternative<token::Function>(result))
+        {
+            return NameKind::function;
+        }
+
+        if (std::holds_alternative<token::Type>(result))
+        {
+            return NameKind::type;
+        }
+
+        return NameKind::unrecognized;
+    }
+
     void ParserImpl::parse()
     {
-        for (lexing::Token next = m_Lexer.next();
-             !std::holds_alternative<lexing::token::End>(next.classification);
-             next = m_Lexer.next())
+        std::size_t sharedCount{0u};
+        if (m_TerminatedContent)
+        {
+            lexing::Lexer{m_TerminatedContent}.tokenize_all(m_Tokens);
+            m_Content = m_Tokens.source();
+        }
+        else
+        {
+            sharedCount = tokenize();
+        }
+
+        // Names never contain control characters (e.g. binary garbage). They are detected while lexing, and the
+        // whole name is rejected.
+        if (m_Tokens.has_control())
+        {
+            m_IsUnparseable = true;
+            m_Checkpoints.clear();
+
+            return;
+        }
+
+        if (!resume_from_checkpoint(sharedCount))
+        {
+            m_Flushed.clear();
+            m_Horizon = 0u;
+            m_Cursor = lexing::TokenCursor{m_Tokens};
+        }
+
+        while (!m_IsUnparseable
+               && lexing::TokenBuffer::endKind != m_Cursor.kind())
+        {
+            m_Cursor.visit_next(
+                [this](std::string_view const content, auto const& tokenClass) { handle_lexer_token(content, tokenClass); });
+        }
+    }
+
+    std::size_t ParserImpl::tokenize()
+    {
+        if (!m_MemoizePrefixes)
         {
-            std::visit(
-                [&](auto const& tokenClass) { handle_lexer_token(next.content, tokenClass); },
-                next.classification);
+            lexing::Lexer{m_Content}.tokenize_all(m_Tokens);
+
+            return 0u;
         }
+
+        // The unchanged prefix still resides at the same address, thus its stable tokens can be kept as they are.
+        std::size_t const count = m_Tokens.stable_prefix(m_SharedLength);
+        m_Tokens.reset(m_Content, count);
+
+        std::size_t const offset = 0u < count
+                                     ? m_Tokens.offsets()[count - 1u] + std::size_t{m_Tokens.lengths()[count - 1u]}
+                                     : 0u;
+        lexing::Lexer{m_Content.substr(offset)}.tokenize_remaining(m_Tokens);
+        m_SharedLength = m_Content.size();
+
+        return count;
     }
+
+    bool ParserImpl::resume_from_checkpoint(std::size_t const sharedCount)
+    {
+        if (!m_MemoizePrefixes
+            || !m_FlushTemplateArgs)
+        {
+            m_Checkpoints.clear();
+
+            return false;
+        }
+
+        // A checkpoint depends on all tokens up to its horizon. As the horizons are ascending, the valid checkpoints
+        // form a prefix.
+        auto const validEnd = std::ranges::partition_point(
+            m_Checkpoints,
+            [&](Checkpoint const& checkpoint) { return checkpoint.horizon < sharedCount; });
+        m_Checkpoints.erase(validEnd, m_Checkpoints.cend());
+        if (m_Checkpoints.empty())
+        {
+            return false;
+        }
+
+        Checkpoint const& checkpoint = m_Checkpoints.back();
+        m_TokenStack = checkpoint.tokenStack;
+        m_Flushed.truncate(checkpoint.flushedCount);
+        m_HasConversionOperator = checkpoint.hasConversionOperator;
+        m_Horizon = checkpoint.horizon;
+        m_Cursor = lexing::TokenCursor{m_Tokens, checkpoint.position};
+
+        return true;
+    }
+
+    void ParserImpl::record_checkpoint()
+    {
+        // Events of template-args are flushed into a shared sequence, which is partially overwritten when the
+        // enclosing args are closed. Thus, checkpoints are just recorded outside of any template-args.
+        if (!m_MemoizePrefixes
+            || !m_FlushTemplateArgs
+            || m_IsUnparseable
+            || m_TokenStack.find_last_bracket<token::OpeningAngle>(m_TokenStack.size()))
+        {
+            return;
+        }
+
+        m_Horizon = std::max(m_Horizon, m_Cursor.position());
+        m_Checkpoints.emplace_back(
+            Checkpoint{
+                .position = m_Cursor.position(),
+                .horizon = m_Horizon,
+                .flushedCount = m_Flushed.size(),
+                .hasConversionOperator = m_HasConversionOperator,
+                .tokenStack = m_TokenStack});
+    }
+
+    bool ParserImpl::try_skip_template_args(std::string_view const opening)
+    {
+        // The first half of a split `<<` is not directly followed by its args, but by another `<`.
+        std::string_view const consumed = m_Tokens.content(m_Cursor.position() - 1u);
+        if (opening.data() + opening.size() != consumed.data() + consumed.size())
+        {
+            return false;
+        }
+
+        // Only args, which directly follow a non-template identifier, can be attached immediately.
+        // Everything else is left to the regular reductions.
+        auto* const id = match_suffix<token::Identifier>(m_TokenStack);
+        if (!id
+            || id->is_template())
+        {
+            return false;
+        }
+
+        // The kinds of all currently open brackets, two bits each, with the innermost at the lowest bits.
+        // Parens are just accepted in function-type position, like `(__cdecl*)(int)`.
+        enum Bracket : std::uint64_t
+        {
+            angle,
+            declarator,
+            params
+        };
+
+        // The role of the previously examined token, which determines the tokens that may follow.
+        // Everything that does not provably reduce to a sequence of types is left to the regular reductions.
+        enum class Role : std::uint8_t
+        {
+            // `<` or the `(` of function-params.
+            opening,
+            // `,`
+            separator,
+            // `class`, `struct` or `enum`
+            typeContext,
+            // `const`, `volatile` or `noexcept`
+            qualifier,
+            // An identifier, which may be followed by `::` or by template-args.
+            name,
+            // A builtin-type keyword, like `int` or `unsigned`.
+            builtin,
+            // Closed template-args.
+            args,
+            // `*`, `&` or `&&`
+            indirection,
+            // `::`
+            scope,
+            // The `(` of a function-ptr declarator.
+            declaratorOpening,
+            // A reserved identifier in a declarator, like `__cdecl`.
+            declaratorConvention,
+            // Any other identifier in a declarator, like the class of a member-function ptr.
+            declaratorName,
+            // `::` in a declarator.
+            declaratorScope,
+            // `*` in a declarator.
+            declaratorPtr,
+            // The `)` of a declarator, which must be followed by the function-params.
+            declaratorClosing,
+            // The `)` of function-params.
+            paramsClosing
+        };
+
+        constexpr std::size_t maxDepth{32u};
+        std::uint64_t openBrackets{angle};
+        std::size_t depth{1u};
+        // Whether the current arg on each depth already has a name, one bit per depth.
+        std::uint64_t namedArgs{0u};
+
+        auto const depth_bit = [&] { return std::uint64_t{1u} << (depth - 1u); };
+
+        auto const open = [&](Bracket const bracket) {
+            openBrackets = (openBrackets << 2u) | bracket;
+            if (maxDepth < ++depth)
+            {
+                return false;
+            }
+
+            namedArgs &= ~depth_bit();
+
+            return true;
+        };
+
+        auto const close = [&](Bracket const bracket) {
+            if (bracket != (openBrackets & 0b11u))
+            {
+                return false;
+            }
+
+            openBrackets >>= 2u;
+            --depth;
+
+            return true;
+        };
+
+        Role role{Role::opening};
+        auto const is_named = [&] { return 0u != (namedArgs & depth_bit()); };
+
+        // Whether the current arg forms a complete type, which may be qualified further.
+        auto const is_type_end = [&] {
+            return is_named()
+                && util::contains(
+                    std::array{Role::name, Role::builtin, Role::args, Role::qualifier, Role::indirection, Role::paramsClosing},
+                    role);
+        };
+
+        auto const is_arg_start = [&] {
+            return !is_named()
+                && util::contains(std::array{Role::opening, Role::separator, Role::qualifier}, role);
+        };
+
+        auto const start_name = [&](Role const next) {
+            namedArgs |= depth_bit();
+            role = next;
+
+            return true;
+        };
+
+        // The tokens are examined directly in the buffer, as most of them just need their kind.
+        // The regular parsing is resumed at the current position, if the region can not be skipped.
+        auto const kinds = m_Tokens.kinds();
+        std::size_t position = m_Cursor.position();
+        std::size_t separators{0u};
+        bool hasContent{false};
+        bool isAfterName{false};
+        bool isAfterSpace{false};
+        for (; 0u < depth; ++position)
+        {
+            lexing::TokenBuffer::Kind const kind = kinds[position];
+            bool const isDirectlyAfterName = std::exchange(isAfterName, false);
+            bool const isDirectlyAfterSpace = std::exchange(isAfterSpace, false);
+            // The decision depends on each examined token, even if the region is not skipped at last.
+            m_Horizon = std::max(m_Horizon, position + 1u);
+
+            if (lexing::TokenBuffer::spaceKind == kind)
+            {
+                isAfterSpace = true;
+
+                continue;
+            }
+
+            if (lexing::TokenBuffer::endKind == kind)
+            {
+                return false;
+            }
+
+            std::optional<lexing::token::OperatorOrPunctuator> op{};
+            if (lexing::TokenBuffer::opOrPunctuatorKind == kind)
+            {
+                op = m_Tokens.get<lexing::token::OperatorOrPunctuator>(position);
+            }
+
+            // A declarator must be followed by its params, otherwise it's something else, e.g. `(*)`.
+            if (Role::declaratorClosing == role
+                && !(op && openingParens == *op))
+            {
+                return false;
+            }
+
+            bool isValid{false};
+            if (lexing::TokenBuffer::keywordKind == kind)
+            {
+                auto const keyword = m_Tokens.get<lexing::token::Keyword>(position);
+                if (keyword.is_type())
+                {
+                    // Multi-keyword types, like `unsigned int`, are merged via the single space in between.
+                    isValid = is_arg_start()
+                                ? start_name(Role::builtin)
+                                : Role::builtin == role && isDirectlyAfterSpace;
+                    role = Role::builtin;
+                }
+                else if (noexceptKeyword == keyword)
+                {
+                    isValid = is_type_end();
+                    role = Role::qualifier;
+                }
+                else if (keyword.is_qualifier())
+                {
+                    isValid = is_type_end() || is_arg_start();
+                    role = Role::qualifier;
+                }
+                // The regular reductions do not accept any qualifiers in front of e.g. `class`.
+                else if (keyword.is_type_context())
+                {
+                    isValid = Role::opening == role || Role::separator == role;
+                    role = Role::typeContext;
+                }
+
+                isAfterName = true;
+            }
+            else if (lexing::TokenBuffer::identifierKind == kind)
+            {
+                // The flags of an identifier are stored as its index.
+                std::uint8_t const flags = m_Tokens.indices()[position];
+                if (is_arg_start() || Role::typeContext == role)
+                {
+                    isValid = start_name(Role::name);
+                }
+                else if (Role::scope == role)
+                {
+                    isValid = true;
+                    role = Role::name;
+                }
+                else if (util::contains(std::array{Role::declaratorOpening, Role::declaratorConvention, Role::declaratorScope}, role))
+                {
+                    isValid = true;
+                    role = 0u != (flags & lexing::token::Identifier::reserved)
+                             ? Role::declaratorConvention
+                             : Role::declaratorName;
+                }
+                // Trailing reserved identifiers (e.g. `__ptr64`) are ignored by the regular reductions, unless they
+                // are glued to closed template-args.
+                else
+                {
+                    isValid = is_type_end()
+                           && !isDirectlyAfterName
+                           && 0u != (flags & lexing::token::Identifier::reserved);
+                    // The type is complete, thus it must not be continued with e.g. `::` or template-args.
+                    role = Role::qualifier;
+                }
+
+                isAfterName = true;
+            }
+            else if (op)
+            {
+                if (openingAngle == *op)
+                {
+                    isValid = isDirectlyAfterName
+                           && Role::name == role
+                           && open(angle);
+                    role = Role::opening;
+                }
+                else if (closingAngle == *op)
+                {
+                    isValid = (Role::opening == role || is_type_end())
+                           && close(angle);
+                    role = Role::args;
+                    isAfterName = true;
+                }
+                // A `>>`, which closes the skipped region with its first half, can not be split here.
+                else if (rightShift == *op)
+                {
+                    isValid = (Role::opening == role || is_type_end())
+                           && close(angle)
+                           && 0u < depth
+                           && close(angle);
+                    role = Role::args;
+                    isAfterName = true;
+                }
+                else if (commaSeparator == *op)
+                {
+                    isValid = is_type_end()
+                           && declarator != (openBrackets & 0b11u);
+                    separators += 1u == depth ? 1u : 0u;
+                    namedArgs &= ~depth_bit();
+                    role = Role::separator;
+                }
+                // Parens directly after a name form a function-identifier, which may not be a valid arg at all
+                // (e.g. `void(int)`). Thus, a declarator is just accepted, when it's separated by a space.
+                else if (openingParens == *op)
+                {
+                    if (Role::declaratorClosing == role)
+                    {
+                        isValid = !isDirectlyAfterSpace
+                               && open(params);
+                        role = Role::opening;
+                    }
+                    else
+                    {
+                        isValid = isDirectlyAfterSpace
+                               && is_type_end()
+                               && Role::paramsClosing != role
+                               && open(declarator);
+                        role = Role::declaratorOpening;
+                    }
+                }
+                else if (closingParens == *op)
+                {
+                    if (declarator == (openBrackets & 0b11u))
+                    {
+                        isValid = Role::declaratorPtr == role
+                               && close(declarator);
+                        role = Role::declaratorClosing;
+                    }
+                    else
+                    {
+                        isValid = (Role::opening == role || is_type_end())
+                               && close(params);
+                        role = Role::paramsClosing;
+                    }
+                }
+                else if (scopeResolution == *op)
+                {
+                    bool const isInDeclarator = Role::declaratorName == role || Role::declaratorConvention == role;
+                    isValid = isDirectlyAfterName
+                           && (isInDeclarator || Role::name == role || Role::args == role);
+                    role = isInDeclarator ? Role::declaratorScope : Role::scope;
+                }
+                else if (pointer == *op)
+                {
+                    if (util::contains(std::array{Role::declaratorOpening, Role::declaratorConvention, Role::declaratorScope}, role))
+                    {
+                        isValid = true;
+                        role = Role::declaratorPtr;
+                    }
+                    else
+                    {
+                        isValid = is_type_end();
+                        role = Role::indirection;
+                    }
+                }
+                // A reference can not be part of a function-ptr declarator, like `(&)`.
+                else if (lvalueRef == *op || rvalueRef == *op)
+                {
+                    isValid = is_type_end();
+                    role = Role::indirection;
+                }
+            }
+
+            if (!isValid)
+            {
+                return false;
+            }
+
+            hasContent = hasContent || 0u < depth;
+        }
+
+        token::ArgSequence args{};
+        args.skipped = hasContent ? separators + 1u : 0u;
+        id->templateArgs = std::move(args);
+        m_Cursor = lexing::TokenCursor{m_Tokens, position};
+
+        return true;
+    }
+
+    void ParserImpl::flush_template_args(std::uint32_t const mark)
+    {
+        auto& id = std::get<token::Identifier>(m_TokenStack.back());
+        CTNP_ASSERT(id.templateArgs, "Identifier has no template-args.");
+
+        token::ArgSequence& args = *id.templateArgs;
+        if (args.types.empty())
+        {
+            return;
+        }
+
+        m_FlushBuffer.clear();
+        NodeRecorder recorder{m_FlushBuffer};
+        m_Traversal(args, recorder, m_Flushed.nodes());
+
+        // The nested ranges have just been spliced into the buffer, thus they are no longer referenced.
+        m_Flushed.truncate(mark);
+        auto const offset = static_cast<std::uint32_t>(m_Flushed.size());
+        for (Node const& node : m_FlushBuffer.nodes())
+        {
+            m_Flushed.push_back(node);
+        }
+
+        args.flushed = token::ArgSequence::Flushed{
+            .offset = offset,
+            .size = static_cast<std::uint32_t>(m_FlushBuffer.size()),
+            .count = static_cast<std::uint32_t>(args.types.size())};
+        args.types.clear();
+        args.types.shrink_to_fit();
+    }
+
     bool ParserImpl::merge_with_next_token() const noexcept
     {
-        auto const* const keyword = peek_if<lexing::token::Keyword>();
+        auto const keyword = peek_if<lexing::token::Keyword>();
 
         return keyword
-            && util::contains(typeKeywordCollection, *keyword);
+            && keyword->is_type();
     }
 
     bool ParserImpl::process_simple_operator()
     {
         auto dropSpaceInput = [this] {
-            if (std::holds_alternative<lexing::token::Space>(m_Lexer.peek().classification))
+            if (lexing::TokenBuffer::spaceKind == m_Cursor.kind())
             {
-                std::ignore = m_Lexer.next();
+                m_Cursor.advance();
             }
         };
 
         dropSpaceInput();
 
         // As we assume valid input, we do not have to check for the actual symbol.
-        if (auto const next = m_Lexer.peek();
-            auto const* operatorToken = std::get_if<lexing::token::OperatorOrPunctuator>(&next.classification))
+        std::string_view const nextContent = m_Cursor.content();
+        if (auto const operatorToken = peek_if<lexing::token::OperatorOrPunctuator>())
         {
-            std::ignore = m_Lexer.next();
+            m_Cursor.advance();
 
             auto const finishMultiOpOperator = [&, this]([[maybe_unused]] lexing::token::OperatorOrPunctuator const& expectedClosingOp) {
-                auto const [closingContent, classification] = m_Lexer.next();
-                CTNP_ASSERT(lexing::token::TokenClass{expectedClosingOp} == classification, "Invalid input.");
+                CTNP_ASSERT(expectedClosingOp == peek_if<lexing::token::OperatorOrPunctuator>(), "Invalid input.");
+                std::string_view const closingContent = m_Cursor.content();
+                m_Cursor.advance();
 
                 std::string_view const content{
-                    next.content.data(),
-                    next.content.size() + closingContent.size()};
+                    nextContent.data(),
+                    nextContent.size() + closingContent.size()};
                 m_TokenStack.emplace_back(
                     token::Identifier{
                         .content = token::Identifier::OperatorInfo{.symbol = content}});
@@ -197,60 +779,62 @@ namespace ctnp::parsing::detail
             {
                 dropSpaceInput();
 
-                if (auto const* const nextOp = peek_if<lexing::token::OperatorOrPunctuator>();
+                if (auto const nextOp = peek_if<lexing::token::OperatorOrPunctuator>();
                     nextOp
                     // When next token starts a function or template, we know it's actually `operator <<`.
                     && (openingParens == *nextOp || openingAngle == *nextOp))
                 {
                     m_TokenStack.emplace_back(
                         token::Identifier{
-                            .content = token::Identifier::OperatorInfo{.symbol = next.content}});
+                            .content = token::Identifier::OperatorInfo{.symbol = nextContent}});
                 }
                 // looks like an `operator< <>`, so just treat both `<` separately.
                 else
                 {
                     m_TokenStack.emplace_back(
                         token::Identifier{
-                            .content = token::Identifier::OperatorInfo{.symbol = next.content.substr(0u, 1u)}});
-                    handle_lexer_token(next.content.substr(1u, 1u), openingAngle);
+                            .content = token::Identifier::OperatorInfo{.symbol = nextContent.substr(0u, 1u)}});
+                    handle_lexer_token(nextContent.substr(1u, 1u), openingAngle);
                 }
             }
             else
             {
                 m_TokenStack.emplace_back(
                     token::Identifier{
-                        .content = token::Identifier::OperatorInfo{.symbol = next.content}});
+                        .content = token::Identifier::OperatorInfo{.symbol = nextContent}});
             }
 
             dropSpaceInput();
 
             return true;
         }
-        else if (auto const* keywordToken = std::get_if<lexing::token::Keyword>(&next.classification);
+        else if (auto const keywordToken = peek_if<lexing::token::Keyword>();
                  keywordToken
-                 && util::contains(std::array{newKeyword, deleteKeyword, coAwaitKeyword}, *keywordToken))
+                 && keywordToken->is_operator_like())
         {
-            std::ignore = m_Lexer.next();
+            m_Cursor.advance();
 
-            std::string_view content = next.content;
+            std::string_view content = nextContent;
 
-            if (newKeyword == *keywordToken || deleteKeyword == *keywordToken)
+            // `co_await` is the only operator-like keyword, which can not be followed by `[]`.
+            if (coAwaitKeyword != *keywordToken)
             {
                 dropSpaceInput();
 
-                if (auto const* const opAfter = peek_if<lexing::token::OperatorOrPunctuator>();
+                if (auto const opAfter = peek_if<lexing::token::OperatorOrPunctuator>();
                     opAfter
                     && openingSquare == *opAfter)
                 {
                     // Strip `[]` or `[ ]` from the input.
-                    std::ignore = m_Lexer.next();
+                    m_Cursor.advance();
                     dropSpaceInput();
-                    auto const closing = m_Lexer.next();
-                    CTNP_ASSERT(closingSquare == std::get<lexing::token::OperatorOrPunctuator>(closing.classification), "Invalid input.");
+                    CTNP_ASSERT(closingSquare == peek_if<lexing::token::OperatorOrPunctuator>(), "Invalid input.");
+                    std::string_view const closingContent = m_Cursor.content();
+                    m_Cursor.advance();
 
                     content = std::string_view{
-                        next.content.data(),
-                        closing.content.data() + closing.content.size()};
+                        nextContent.data(),
+                        closingContent.data() + closingContent.size()};
                 }
             }
 
@@ -319,7 +903,8 @@ namespace ctnp::parsing::detail
                 && merge_with_next_token())
             {
                 auto& curContent = std::get<std::string_view>(id->content);
-                auto const [nextContent, _] = m_Lexer.next();
+                std::string_view const nextContent = m_Cursor.content();
+                m_Cursor.advance();
                 // Merge both keywords by simply treating them as contiguous content.
                 CTNP_ASSERT(curContent.data() + curContent.size() == content.data(), "Violated expectation.");
                 CTNP_ASSERT(content.data() + content.size() == nextContent.data(), "Violated expectation.");
@@ -337,7 +922,7 @@ namespace ctnp::parsing::detail
         // For example, consider the type names `void ()` and `foo()`:
         // - `void ()` represents a function type returning `void`.
         // - `foo()` represents a function named `foo`.
-        if (auto const* const nextOp = peek_if<lexing::token::OperatorOrPunctuator>();
+        if (auto const nextOp = peek_if<lexing::token::OperatorOrPunctuator>();
             nextOp
             && util::contains(std::array{openingAngle, openingParens, openingCurly, singleQuote, backtick}, *nextOp))
         {
@@ -348,32 +933,32 @@ namespace ctnp::parsing::detail
     void ParserImpl::handle_lexer_token([[maybe_unused]] std::string_view const content, lexing::token::Identifier const& identifier)
     {
         m_TokenStack.emplace_back(
-            token::Identifier{.content = identifier.content});
+            token::Identifier{
+                .flags = identifier.flags,
+                .content = identifier.content});
     }
 
     void ParserImpl::handle_lexer_token(std::string_view const content, lexing::token::Keyword const& keyword)
     {
-        if (constKeyword == keyword)
+        if (keyword.is_qualifier())
         {
             auto& specs = token::get_or_emplace_specs(m_TokenStack);
-            CTNP_ASSERT(!specs.layers.empty(), "Zero spec layers detected.");
-            auto& top = specs.layers.back();
-            CTNP_ASSERT(!top.isConst, "Specs is already const.");
-            top.isConst = true;
-        }
-        else if (volatileKeyword == keyword)
-        {
-            auto& specs = token::get_or_emplace_specs(m_TokenStack);
-            CTNP_ASSERT(!specs.layers.empty(), "Zero spec layers detected.");
-            auto& top = specs.layers.back();
-            CTNP_ASSERT(!top.isVolatile, "Specs is already volatile.");
-            top.isVolatile = true;
-        }
-        else if (noexceptKeyword == keyword)
-        {
-            auto& specs = token::get_or_emplace_specs(m_TokenStack);
-            CTNP_ASSERT(!specs.isNoexcept, "Specs already is a noexcept.");
-            specs.isNoexcept = true;
+            if (constKeyword == keyword)
+            {
+                CTNP_ASSERT(!specs.top().isConst, "Specs is already const.");
+                specs.add_const();
+            }
+            else if (volatileKeyword == keyword)
+            {
+                CTNP_ASSERT(!specs.top().isVolatile, "Specs is already volatile.");
+                specs.add_volatile();
+            }
+            else
+            {
+                CTNP_ASSERT(noexceptKeyword == keyword, "Unexpected qualifier.", keyword.text());
+                CTNP_ASSERT(!specs.isNoexcept, "Specs already is a noexcept.");
+                specs.isNoexcept = true;
+            }
         }
         else if (operatorKeyword == keyword && !process_simple_operator())
         {
@@ -383,18 +968,17 @@ namespace ctnp::parsing::detail
             m_TokenStack.emplace_back(token::OperatorKeyword{});
             m_HasConversionOperator = true;
         }
-        else if (constexpr std::array collection{classKeyword, structKeyword, enumKeyword};
-                 util::contains(collection, keyword))
+        else if (keyword.is_type_context())
         {
             // This token is needed, so we do not accidentally treat e.g. `(anonymous class)` as function args,
             // because otherwise there would just be the `anonymous` identifier left.
             m_TokenStack.emplace_back(token::TypeContext{.content = content});
         }
-        else if (util::contains(typeKeywordCollection, keyword))
+        else if (keyword.is_type())
         {
             m_TokenStack.emplace_back(
                 token::Identifier{
-                    .isBuiltinType = true,
+                    .flags = static_cast<std::uint8_t>(token::Identifier::Flag::builtin | lexing::token::Identifier::classify(content)),
                     .content = content});
         }
     }
@@ -409,6 +993,8 @@ namespace ctnp::parsing::detail
                 std::in_place_type<token::ScopeResolution>,
                 content);
             token::try_reduce_as_scope_sequence(m_TokenStack);
+
+            record_checkpoint();
         }
         else if (commaSeparator == token)
         {
@@ -437,27 +1023,55 @@ namespace ctnp::parsing::detail
         else if (pointer == token)
         {
             auto& specs = token::get_or_emplace_specs(m_TokenStack);
-            specs.layers.emplace_back();
+            specs.add_ptr();
         }
         else if (openingAngle == token)
         {
+            if (m_SkipTemplateArgs
+                && try_skip_template_args(content))
+            {
+                return;
+            }
+
             m_TokenStack.emplace_back(
-                std::in_place_type<token::OpeningAngle>,
-                content);
+                token::OpeningAngle{
+                    .content = content,
+                    .flushMark = static_cast<std::uint32_t>(m_Flushed.size())});
         }
         else if (closingAngle == token)
         {
+            if (reject_unbalanced_closer<token::OpeningAngle>())
+            {
+                return;
+            }
+
             if (is_suffix_of<token::Type>(m_TokenStack)
                 || token::try_reduce_as_type(m_TokenStack))
             {
                 token::try_reduce_as_arg_sequence(m_TokenStack);
             }
 
+            // Just placeholders (e.g. `` `a>b' ``) may contain a closing angle without an opening one. In this case,
+            // no template-args can be reduced, thus the flush-mark is never used.
+            auto const openingIndex = m_TokenStack.find_last_bracket<token::OpeningAngle>(m_TokenStack.size());
+            std::uint32_t const flushMark = openingIndex
+                                              ? std::get<token::OpeningAngle>(m_TokenStack.data()[*openingIndex]).flushMark
+                                              : 0u;
+
             m_TokenStack.emplace_back(
                 std::in_place_type<token::ClosingAngle>,
                 content);
-            token::try_reduce_as_template_identifier(m_TokenStack)
-                || token::try_reduce_as_placeholder_identifier_wrapped<token::OpeningAngle, token::ClosingAngle>(m_TokenStack);
+            if (token::try_reduce_as_template_identifier(m_TokenStack))
+            {
+                if (m_FlushTemplateArgs)
+                {
+                    flush_template_args(flushMark);
+                }
+            }
+            else
+            {
+                token::try_reduce_as_placeholder_identifier_wrapped<token::OpeningAngle, token::ClosingAngle>(m_TokenStack);
+            }
         }
         else if (openingParens == token)
         {
@@ -467,8 +1081,13 @@ namespace ctnp::parsing::detail
         }
         else if (closingParens == token)
         {
+            if (reject_unbalanced_closer<token::OpeningParens>())
+            {
+                return;
+            }
+
             bool isNextOpeningParens{false};
-            if (auto const* const nextOp = peek_if<lexing::token::OperatorOrPunctuator>())
+            if (auto const nextOp = peek_if<lexing::token::OperatorOrPunctuator>())
             {
                 isNextOpeningParens = (openingParens == *nextOp);
             }
@@ -504,6 +1123,11 @@ namespace ctnp::parsing::detail
         }
         else if (closingCurly == token)
         {
+            if (reject_unbalanced_closer<token::OpeningCurly>())
+            {
+                return;
+            }
+
             m_TokenStack.emplace_back(
                 std::in_place_type<token::ClosingCurly>,
                 content);
@@ -554,11 +1178,11 @@ namespace ctnp::parsing::detail
         // So, just ignore it and skip the next identifier.
         else if (plus == token)
         {
-            if (auto const* const nextId = peek_if<lexing::token::Identifier>();
+            if (auto const nextId = peek_if<lexing::token::Identifier>();
                 nextId
                 && nextId->content.starts_with("0x"))
             {
-                std::ignore = m_Lexer.next();
+                m_Cursor.advance();
             }
         }
         // The msvc c++23 `std::stacktrace` implementation seems to add something which looks like the executable-name as prefix.
@@ -0,0 +1,93 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/ParsedName.hpp"
+
+#include <iterator>
+#include <string>
+#include <utility>
+
+using namespace ctnp;
+
+TEST_CASE(
+    "ParsedName::parse_type parses the given type-name once.",
+    "[prettify]")
+{
+    std::string name{"const std::vector<int, std::allocator<int>>* volatile&"};
+    ParsedName const parsed = ParsedName::parse_type(name);
+
+    // The source is owned, thus the original name may change.
+    std::string const original = std::exchange(name, "garbage");
+    CHECK(original == parsed.source());
+    CHECK(parsed.is_recognized());
+
+    std::string expected{};
+    prettify_type(std::back_inserter(expected), original);
+    CHECK(expected == parsed.pretty());
+
+    SECTION("It can be visited any number of times.")
+    {
+        std::string first{};
+        PrintVisitor firstVisitor{std::back_inserter(first)};
+        parsed.accept(firstVisitor);
+
+        std::string second{};
+        PrintVisitor secondVisitor{std::back_inserter(second)};
+        parsed.accept(secondVisitor);
+
+        CHECK(expected == first);
+        CHECK(expected == second);
+    }
+
+    SECTION("The cached rendering is stable.")
+    {
+        std::string const* const rendering = &parsed.pretty();
+
+        CHECK(rendering == &parsed.pretty());
+    }
+}
+
+TEST_CASE(
+    "ParsedName::parse_function parses the given function-name once.",
+    "[prettify]")
+{
+    std::string const name{"void foo::bar<int>(float) const [with T = int]"};
+    ParsedName const parsed = ParsedName::parse_function(name);
+
+    CHECK(name == parsed.source());
+    CHECK(parsed.is_recognized());
+
+    std::string expected{};
+    prettify_function(std::back_inserter(expected), name);
+    CHECK(expected == parsed.pretty());
+}
+
+TEST_CASE(
+    "ParsedName stays valid, when moved.",
+    "[prettify]")
+{
+    // Short enough for the small-string optimization.
+    ParsedName source = ParsedName::parse_type("int&");
+    std::string const expected = source.pretty();
+
+    ParsedName const target{std::move(source)};
+    CHECK("int&" == target.source());
+    CHECK(expected == target.pretty());
+
+    std::string rendered{};
+    PrintVisitor visitor{std::back_inserter(rendered)};
+    target.accept(visitor);
+    CHECK(expected == rendered);
+}
+
+TEST_CASE(
+    "ParsedName reports unrecognized names.",
+    "[prettify]")
+{
+    ParsedName const parsed = ParsedName::parse_type("foo)");
+
+    CHECK(!parsed.is_recognized());
+    CHECK("foo)" == parsed.pretty());
+}
@@ -323,6 +323,31 @@ TEMPLATE_TEST_CASE(
     }
 }
 
+TEMPLATE_TEST_CASE(
+    "prettify_type accepts NUL-terminated names.",
+    "[prettify]",
+    int,
+    int const*,
+    std::string,
+    std::vector<int>,
+    void (*)(int&&),
+    outer_type::my_type)
+{
+    std::string const name{type_name<TestType>()};
+    CAPTURE(name);
+
+    std::ostringstream expected{};
+    ctnp::prettify_type(
+        std::ostreambuf_iterator{expected},
+        std::string_view{name});
+
+    std::ostringstream ss{};
+    ctnp::prettify_type(
+        std::ostreambuf_iterator{ss},
+        name.c_str());
+    REQUIRE(std::move(expected).str() == std::move(ss).str());
+}
+
 TEST_CASE(
     "prettify_type enhances names appearance.",
     "[prettify]")
@@ -1403,3 +1428,305 @@ TEST_CASE(
         ss.str(),
         Catch::Matchers::Equals(+"ret my_function<...>()"));
 }
+
+namespace
+{
+    class CountingResource final
+        : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{};
+
+    private:
+        alignas(std::max_align_t) std::array<std::byte, 64u * 1024u> m_Buffer{};
+        std::pmr::monotonic_buffer_resource m_Arena{m_Buffer.data(), m_Buffer.size(), std::pmr::null_memory_resource()};
+
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            ++allocations;
+
+            return m_Arena.allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) override
+        {
+            m_Arena.deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE(
+    "prettify_type and prettify_function draw their allocations from the given resource.",
+    "[prettify]")
+{
+    std::string const name = "void (__cdecl*)(std::vector<int, std::allocator<int>> const volatile&&, int const* const*) noexcept";
+
+    SECTION("When prettifying a type.")
+    {
+        std::ostringstream expected{};
+        ctnp::prettify_type(std::ostreambuf_iterator{expected}, name);
+
+        CountingResource resource{};
+        std::ostringstream ss{};
+        ctnp::prettify_type(std::ostreambuf_iterator{ss}, name, &resource);
+
+        CHECK(0u < resource.allocations);
+        CHECK(std::move(expected).str() == std::move(ss).str());
+    }
+
+    SECTION("When prettifying a function.")
+    {
+        std::ostringstream expected{};
+        ctnp::prettify_function(std::ostreambuf_iterator{expected}, name);
+
+        CountingResource resource{};
+        std::ostringstream ss{};
+        ctnp::prettify_function(std::ostreambuf_iterator{ss}, name, &resource);
+
+        CHECK(0u < resource.allocations);
+        CHECK(std::move(expected).str() == std::move(ss).str());
+    }
+}
+
+namespace
+{
+    class CountingUpstream final
+        : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{};
+
+    private:
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            ++allocations;
+
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE(
+    "prettify_type and prettify_function stop allocating, once the session is warmed up.",
+    "[prettify]")
+{
+    std::string const name = "void (__cdecl*)(std::vector<int, std::allocator<int>> const volatile&&, int const* const*) noexcept";
+    std::string const functionName = "std::basic_string<char>::operator std::basic_string_view<char>() const";
+
+    CountingUpstream resource{};
+    ctnp::parsing::ParserSession session{&resource};
+
+    auto const prettifyAll = [&] {
+        std::ostringstream ss{};
+        ctnp::prettify_type(session, std::ostreambuf_iterator{ss}, name);
+        ss << '\n';
+        ctnp::prettify_type(session, std::ostreambuf_iterator{ss}, name.c_str());
+        ss << '\n';
+        ctnp::prettify_function(session, std::ostreambuf_iterator{ss}, functionName);
+
+        return std::move(ss).str();
+    };
+
+    std::ostringstream expected{};
+    ctnp::prettify_type(std::ostreambuf_iterator{expected}, name);
+    expected << '\n';
+    ctnp::prettify_type(std::ostreambuf_iterator{expected}, name);
+    expected << '\n';
+    ctnp::prettify_function(std::ostreambuf_iterator{expected}, functionName);
+
+    CHECK(std::move(expected).str() == prettifyAll());
+
+    std::size_t const warmedUp = resource.allocations;
+    CHECK(0u < warmedUp);
+    for (int i = 0; i < 10; ++i)
+    {
+        CHECK_FALSE(prettifyAll().empty());
+    }
+    CHECK(warmedUp == resource.allocations);
+}
+
+TEST_CASE(
+    "prettify_type and prettify_function print unparseable names as they are.",
+    "[prettify]")
+{
+    std::string const name = GENERATE(
+        std::string{"foo)"},
+        std::string{"std::vector<int>>"},
+        std::string{"foo}::bar"},
+        std::string{"int\x01\x02"},
+        std::string{"void foo(\x7F)"},
+        std::string{"std::vector<int", 11u} + '\0' + std::string{"abc>"});
+    CAPTURE(name);
+
+    SECTION("When prettifying a type.")
+    {
+        std::ostringstream ss{};
+        ctnp::prettify_type(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(name == std::move(ss).str());
+    }
+
+    SECTION("When prettifying a function.")
+    {
+        std::ostringstream ss{};
+        ctnp::prettify_function(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(name == std::move(ss).str());
+    }
+}
+
+TEST_CASE(
+    "prettify_type and prettify_function keep unmatched closing brackets inside of placeholders.",
+    "[prettify]")
+{
+    auto const [name, expected] = GENERATE(
+        (table<std::string, std::string>)({
+            {          "`a>b'",           "a>b"},
+            {          "`a)b'",           "a)b"},
+            {          "`a}b'",           "a}b"},
+            {"foo::`a>b'::bar", "foo::a>b::bar"},
+            {      "'lambda>'",       "lambda>"}
+    }));
+    CAPTURE(name);
+
+    SECTION("When prettifying a type.")
+    {
+        std::ostringstream ss{};
+        ctnp::prettify_type(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(expected == std::move(ss).str());
+    }
+
+    SECTION("When prettifying a function.")
+    {
+        std::ostringstream ss{};
+        ctnp::prettify_function(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(expected == std::move(ss).str());
+    }
+}
+
+TEST_CASE(
+    "prettify_type and prettify_function support tokens, which exceed the packed token-length.",
+    "[prettify]")
+{
+    std::string const identifier(70000u, 'a');
+
+    SECTION("When prettifying a type.")
+    {
+        std::ostringstream ss{};
+        ctnp::prettify_type(std::ostreambuf_iterator{ss}, "ns::" + identifier + "< int >");
+
+        CHECK("ns::" + identifier + "<...>" == std::move(ss).str());
+    }
+
+    SECTION("When prettifying a function.")
+    {
+        std::ostringstream ss{};
+        ctnp::prettify_function(std::ostreambuf_iterator{ss}, "void " + identifier + "( int , double )");
+
+        CHECK("void " + identifier + "(...)" == std::move(ss).str());
+    }
+}
+
+TEST_CASE(
+    "prettify detects, whether a name denotes a type or a function.",
+    "[prettify]")
+{
+    SECTION("When a type is given.")
+    {
+        std::string const name = GENERATE(
+            std::string{"int const*"},
+            std::string{"std::vector<int, std::allocator<int>>"},
+            std::string{"void (__cdecl*)(int const volatile&&) noexcept"});
+        CAPTURE(name);
+
+        std::ostringstream expected{};
+        ctnp::prettify_type(std::ostreambuf_iterator{expected}, name);
+
+        std::ostringstream ss{};
+        auto const result = ctnp::prettify(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(ctnp::parsing::NameKind::type == result.kind);
+        CHECK(std::move(expected).str() == std::move(ss).str());
+    }
+
+    SECTION("When a function is given.")
+    {
+        std::string const name = GENERATE(
+            std::string{"void foo(int)"},
+            std::string{"std::basic_string<char>::operator std::basic_string_view<char>() const"},
+            std::string{"void foo<int>(int&&) && [with T = int]"},
+            std::string{"void foo<int>(int&&) && [T = int]"},
+            std::string{"void foo<int>() [with T = int; U = int [3]]"});
+        CAPTURE(name);
+
+        std::ostringstream expected{};
+        ctnp::prettify_function(std::ostreambuf_iterator{expected}, name);
+
+        std::ostringstream ss{};
+        auto const result = ctnp::prettify(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(ctnp::parsing::NameKind::function == result.kind);
+        CHECK(std::move(expected).str() == std::move(ss).str());
+    }
+
+    SECTION("When an array type is given.")
+    {
+        std::string const name = GENERATE(
+            std::string{"int[3]"},
+            std::string{"int [3]"},
+            std::string{"int (&)[3]"});
+        CAPTURE(name);
+
+        std::ostringstream expected{};
+        ctnp::prettify_type(std::ostreambuf_iterator{expected}, name);
+
+        std::ostringstream ss{};
+        auto const result = ctnp::prettify(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(ctnp::parsing::NameKind::function != result.kind);
+        CHECK(name == expected.str());
+        CHECK(std::move(expected).str() == std::move(ss).str());
+    }
+
+    SECTION("When an unparseable name is given.")
+    {
+        std::string const name = GENERATE(
+            std::string{"foo)"},
+            std::string{"(int"});
+        CAPTURE(name);
+
+        std::ostringstream ss{};
+        auto const result = ctnp::prettify(std::ostreambuf_iterator{ss}, name);
+
+        CHECK(ctnp::parsing::NameKind::unrecognized == result.kind);
+        CHECK(name == std::move(ss).str());
+    }
+
+    SECTION("When a session is used.")
+    {
+        ctnp::parsing::ParserSession session{};
+
+        std::ostringstream ss{};
+        CHECK(ctnp::parsing::NameKind::type == ctnp::prettify(session, std::ostreambuf_iterator{ss}, "int const*").kind);
+        CHECK(ctnp::parsing::NameKind::function == ctnp::prettify(session, std::ostreambuf_iterator{ss}, "void foo(int)").kind);
+    }
+}
@@ -5,6 +5,8 @@
 
 #include "ctnp/lexing/Lexer.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <optional>
 
 using namespace ctnp;
@@ -149,6 +151,61 @@ TEST_CASE(
     }
 }
 
+TEST_CASE(
+    "lexing::is_control determines, whether the given character is a non-space control character.",
+    "[lexer]")
+{
+    SECTION("When a control character is given, returns true.")
+    {
+        char const input = GENERATE('\0', '\x01', '\x1B', '\x1F', '\x7F');
+
+        CHECK(lexing::is_control(input));
+    }
+
+    SECTION("When no control character is given, returns false.")
+    {
+        char const input = GENERATE('a', '_', ' ', '\t', '\n', '~', static_cast<char>(0xC3));
+
+        CHECK(!lexing::is_control(input));
+    }
+}
+
+TEST_CASE(
+    "lexing::detail::charClassTable classifies all characters.",
+    "[lexer]")
+{
+    auto const c = static_cast<char>(GENERATE(range(0, 256)));
+    CAPTURE(static_cast<int>(c));
+
+    SECTION("Operator or punctuator prefixes are detected.")
+    {
+        bool const expected = !util::prefix_range(
+                                   lexing::token::OperatorOrPunctuator::textCollection,
+                                   std::string_view{&c, 1u})
+                                   .empty();
+
+        CHECK(expected == lexing::detail::has_char_class(c, lexing::detail::opOrPunctuatorPrefix));
+    }
+
+    SECTION("Single character operators or punctuators are detected.")
+    {
+        bool const expected = std::ranges::binary_search(
+            lexing::token::OperatorOrPunctuator::textCollection,
+            std::string_view{&c, 1u});
+
+        CHECK(expected == lexing::detail::has_char_class(c, lexing::detail::opOrPunctuator));
+    }
+
+    SECTION("Spaces and digits are detected.")
+    {
+        auto const uc = static_cast<unsigned char>(c);
+        bool const isAscii = uc < 128u;
+
+        CHECK((isAscii && std::isspace(uc)) == lexing::detail::has_char_class(c, lexing::detail::space));
+        CHECK((isAscii && std::isdigit(uc)) == lexing::detail::has_char_class(c, lexing::detail::digit));
+    }
+}
+
 TEST_CASE(
     "printing::type::lexing::NameLexer extracts tokens from given input.",
     "[lexer]")
@@ -614,3 +671,326 @@ TEST_CASE(
         std::string{token.text()},
         Catch::Matchers::Equals(tokenText));
 }
+
+TEST_CASE(
+    "lexing::token::Keyword::find determines the keyword index.",
+    "[lexer]")
+{
+    SECTION("When a keyword is given, returns its index.")
+    {
+        auto const index = GENERATE(range(0, static_cast<int>(lexing::token::Keyword::textCollection.size())));
+        std::string const text{lexing::token::Keyword::textCollection[index]};
+        CAPTURE(text);
+
+        CHECK(index == lexing::token::Keyword::find(text));
+    }
+
+    SECTION("When no keyword is given, returns -1.")
+    {
+        std::string const text = GENERATE("", "foo", "Int", "in", "intt", "const_", "_const", "char64_t", "co_awaitco_await");
+        CAPTURE(text);
+
+        CHECK(-1 == lexing::token::Keyword::find(text));
+    }
+}
+
+TEST_CASE(
+    "lexing::token::Keyword has precomputed properties.",
+    "[lexer]")
+{
+    SECTION("Builtin-types are marked as type.")
+    {
+        lexing::token::Keyword const keyword{GENERATE(from_range(lexing::detail::texts::typeKeywords))};
+        CAPTURE(keyword.text());
+
+        CHECK(keyword.is_type());
+        CHECK(!keyword.is_qualifier());
+        CHECK(!keyword.is_type_context());
+        CHECK(!keyword.is_operator_like());
+    }
+
+    SECTION("Qualifiers are marked as such.")
+    {
+        lexing::token::Keyword const keyword{GENERATE("const", "volatile", "noexcept")};
+        CAPTURE(keyword.text());
+
+        CHECK(!keyword.is_type());
+        CHECK(keyword.is_qualifier());
+        CHECK(!keyword.is_type_context());
+        CHECK(!keyword.is_operator_like());
+    }
+
+    SECTION("Type-contexts are marked as such.")
+    {
+        lexing::token::Keyword const keyword{GENERATE("class", "struct", "enum")};
+        CAPTURE(keyword.text());
+
+        CHECK(!keyword.is_type());
+        CHECK(!keyword.is_qualifier());
+        CHECK(keyword.is_type_context());
+        CHECK(!keyword.is_operator_like());
+    }
+
+    SECTION("Operator-likes are marked as such.")
+    {
+        lexing::token::Keyword const keyword{GENERATE("new", "delete", "co_await")};
+        CAPTURE(keyword.text());
+
+        CHECK(!keyword.is_type());
+        CHECK(!keyword.is_qualifier());
+        CHECK(!keyword.is_type_context());
+        CHECK(keyword.is_operator_like());
+    }
+
+    SECTION("Other keywords do not have any property.")
+    {
+        lexing::token::Keyword const keyword{GENERATE("operator", "public", "static", "constexpr", "and")};
+        CAPTURE(keyword.text());
+
+        CHECK(!keyword.is_type());
+        CHECK(!keyword.is_qualifier());
+        CHECK(!keyword.is_type_context());
+        CHECK(!keyword.is_operator_like());
+    }
+}
+
+TEST_CASE(
+    "lexing::token::Identifier::classify determines the identifier flags.",
+    "[lexer]")
+{
+    using Flag = lexing::token::Identifier::Flag;
+
+    auto const [input, expected] = GENERATE(
+        (table<std::string_view, std::uint8_t>)({
+            {                  "foo",                                 Flag::none},
+            {                 "_foo",                                 Flag::none},
+            {                "__foo",                             Flag::reserved},
+            {              "__cdecl",                             Flag::reserved},
+            {         "{lambda()#1}",                          Flag::braceLambda},
+            { "{lambda(int, int)#2}",                          Flag::braceLambda},
+            {             "'lambda'",                         Flag::quotedLambda},
+            {            "'lambda0'",                         Flag::quotedLambda},
+            {         "<lambda_123>",                           Flag::msvcLambda},
+            {        "<lambda(int)>",                          Flag::angleLambda},
+            {"`anonymous namespace'",                       Flag::backtickQuoted},
+            {                  "`2'", Flag::backtickQuoted | Flag::msvcAuxiliary},
+            {                   "`'", Flag::backtickQuoted | Flag::msvcAuxiliary},
+            {                    "`",                                 Flag::none},
+            {            "<lambda_1",                                 Flag::none},
+            {              "lambda'",                                 Flag::none}
+    }));
+    CAPTURE(input);
+
+    CHECK(expected == lexing::token::Identifier::classify(input));
+}
+
+TEST_CASE(
+    "lexing::Lexer determines the flags of identifiers.",
+    "[lexer]")
+{
+    lexing::Lexer lexer{"__ptr64 foo"};
+
+    auto const reserved = std::get<lexing::token::Identifier>(lexer.next().classification);
+    CHECK("__ptr64" == reserved.content);
+    CHECK(reserved.has_flags(lexing::token::Identifier::reserved));
+
+    CHECK(std::holds_alternative<lexing::token::Space>(lexer.next().classification));
+
+    auto const plain = std::get<lexing::token::Identifier>(lexer.next().classification);
+    CHECK("foo" == plain.content);
+    CHECK(lexing::token::Identifier::none == plain.flags);
+}
+
+TEST_CASE(
+    "lexing::detail::opOrPunctuatorDfa performs longest-match recognition.",
+    "[lexer]")
+{
+    constexpr auto const& dfa = lexing::detail::opOrPunctuatorDfa;
+    constexpr auto const& collection = lexing::token::OperatorOrPunctuator::textCollection;
+
+    SECTION("When an operator or punctuator is given, it is recognized.")
+    {
+        auto const index = GENERATE(range(0, static_cast<int>(collection.size())));
+        std::string const text{collection[index]};
+        CAPTURE(text);
+
+        auto const [length, matchIndex] = dfa.longest_match(text);
+        CHECK(text.size() == length);
+        CHECK(index == matchIndex);
+    }
+
+    SECTION("When followed by other characters, the longest match is chosen.")
+    {
+        auto const [input, expected] = GENERATE(
+            (table<std::string_view, std::string_view>)({
+                { "->*x", "->*"},
+                { "<=>=", "<=>"},
+                { "<<=<", "<<="},
+                {  "<<>",  "<<"},
+                { "...x", "..."},
+                {   "..",   "."},
+                {  "::a",  "::"},
+                {  ">>=", ">>="},
+                {"<:foo",  "<:"},
+                {  "&&&",  "&&"}
+        }));
+        CAPTURE(input);
+
+        auto const [length, matchIndex] = dfa.longest_match(input);
+        REQUIRE(0 <= matchIndex);
+        CHECK(expected.size() == length);
+        CHECK(expected == collection[matchIndex]);
+    }
+
+    SECTION("When no operator or punctuator is given, nothing is matched.")
+    {
+        std::string_view const input = GENERATE("", "a", "_", " ", "#", "@");
+        CAPTURE(input);
+
+        auto const [length, matchIndex] = dfa.longest_match(input);
+        CHECK(0u == length);
+        CHECK(-1 == matchIndex);
+    }
+}
+
+TEST_CASE(
+    "lexing::Lexer is usable during constant evaluation.",
+    "[lexer]")
+{
+    SECTION("Tokens can be inspected directly.")
+    {
+        constexpr bool result = [] {
+            lexing::Lexer lexer{"const std::vector<int>&"};
+
+            return lexing::token::Keyword{"const"} == std::get<lexing::token::Keyword>(lexer.next().classification)
+                && std::holds_alternative<lexing::token::Space>(lexer.next().classification)
+                && "std" == std::get<lexing::token::Identifier>(lexer.next().classification).content
+                && lexing::token::OperatorOrPunctuator{"::"} == std::get<lexing::token::OperatorOrPunctuator>(lexer.next().classification)
+                && "vector" == lexer.next().content
+                && "<" == lexer.next().content
+                && "int" == lexer.next().content
+                && ">" == lexer.next().content
+                && "&" == lexer.next().content
+                && std::holds_alternative<lexing::token::End>(lexer.next().classification);
+        }();
+
+        STATIC_CHECK(result);
+    }
+
+    SECTION("Names can be tokenized into packed tokens.")
+    {
+        static constexpr std::string_view name{"void foo(int  const*)"};
+        constexpr std::size_t count = lexing::token_count(name);
+        STATIC_CHECK(9u == count);
+
+        static constexpr std::array tokens = lexing::tokenize_packed<count>(name);
+        STATIC_CHECK("foo" == tokens[2].content(name));
+        STATIC_CHECK(lexing::PackedToken::opOrPunctuatorKind == tokens[3].kind);
+        STATIC_CHECK(lexing::PackedToken::keywordKind == tokens[5].kind);
+        STATIC_CHECK(lexing::PackedToken::endKind == tokens.back().kind);
+
+        lexing::Lexer lexer{name};
+        for (lexing::PackedToken const& token : tokens)
+        {
+            CHECK(lexing::PackedToken::pack(lexer.next(), name) == token);
+        }
+    }
+}
+
+TEST_CASE(
+    "lexing::Lexer treats NUL-terminated text like the equivalent std::string_view.",
+    "[lexer]")
+{
+    std::string const input = GENERATE(
+        "",
+        " ",
+        "\t ",
+        "foo",
+        "foo ",
+        "const int&",
+        "std::vector<int, std::allocator<int>>::operator[]",
+        "void (__cdecl*)(int const volatile&&) noexcept",
+        "operator<=>",
+        "`anonymous namespace'::{lambda()#1}::operator()",
+        "foo->*");
+    CAPTURE(input);
+
+    lexing::Lexer expectedLexer{std::string_view{input}};
+    lexing::Lexer lexer{input.c_str()};
+    for (;;)
+    {
+        lexing::Token const expected = expectedLexer.next();
+        lexing::Token const token = lexer.next();
+
+        CHECK(expected.content == token.content);
+        CHECK(expected.content.data() == token.content.data());
+        CHECK(expected.classification == token.classification);
+
+        if (std::holds_alternative<lexing::token::End>(expected.classification))
+        {
+            break;
+        }
+    }
+
+    CHECK(std::string_view{input} == lexer.source());
+    CHECK(std::holds_alternative<lexing::token::End>(lexer.next().classification));
+}
+
+TEST_CASE(
+    "lexing::Lexer records control characters, but lexes them as part of identifiers.",
+    "[lexer]")
+{
+    auto const [input, expectedIdentifier, expectedControl] = GENERATE(
+        (table<std::string, std::string, bool>)({
+            {                          "foo",                          "foo", false},
+            {                 "foo\t\n bar",                          "bar", false},
+            {                   "\x01""foo",                   "\x01""foo",  true},
+            {                 "foo\x01\x02",                 "foo\x01\x02",  true},
+            {               "foo\x7F""bar",               "foo\x7F""bar",  true},
+            {std::string{"foo\0bar", 7u}, std::string{"foo\0bar", 7u},  true}
+    }));
+    CAPTURE(input);
+
+    lexing::Lexer lexer{std::string_view{input}};
+    std::string_view identifier{};
+    for (lexing::Token token = lexer.next();
+         !std::holds_alternative<lexing::token::End>(token.classification);
+         token = lexer.next())
+    {
+        if (std::holds_alternative<lexing::token::Identifier>(token.classification))
+        {
+            identifier = token.content;
+        }
+    }
+
+    CHECK(expectedIdentifier == identifier);
+    CHECK(expectedControl == lexer.has_control());
+
+    SECTION("The token-buffer is marked accordingly.")
+    {
+        lexing::TokenBuffer buffer{};
+        lexing::Lexer{std::string_view{input}}.tokenize_all(buffer);
+
+        CHECK(expectedControl == buffer.has_control());
+        if (expectedControl)
+        {
+            CHECK(0u == buffer.stable_prefix(input.size()));
+        }
+    }
+}
+
+TEST_CASE(
+    "lexing::detail::opOrPunctuatorDfa never matches beyond the NUL-terminator.",
+    "[lexer]")
+{
+    constexpr auto& dfa = lexing::detail::opOrPunctuatorDfa;
+
+    // The remainder after the terminator would otherwise extend the match.
+    constexpr std::array text{'-', '>', '\0', '*'};
+    auto const [length, matchIndex] = dfa.longest_match(text.data());
+    REQUIRE(0 <= matchIndex);
+    CHECK(2u == length);
+    CHECK("->" == lexing::token::OperatorOrPunctuator::textCollection[matchIndex]);
+
+    CHECK(0u == dfa.longest_match("").length);
+}
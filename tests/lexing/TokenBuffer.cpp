@@ -0,0 +1,259 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/lexing/TokenBuffer.hpp"
+#include "ctnp/lexing/Lexer.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace ctnp;
+
+namespace
+{
+    [[nodiscard]]
+    constexpr bool is_same_token(lexing::Token const& lhs, lexing::Token const& rhs) noexcept
+    {
+        return lhs.content == rhs.content
+            && lhs.content.data() == rhs.content.data()
+            && lhs.classification == rhs.classification;
+    }
+}
+
+TEST_CASE(
+    "lexing::TokenBuffer kinds correspond to the token::TokenClass alternatives.",
+    "[lexer]")
+{
+    STATIC_CHECK(0u == lexing::TokenBuffer::endKind);
+    STATIC_CHECK(1u == lexing::TokenBuffer::spaceKind);
+    STATIC_CHECK(2u == lexing::TokenBuffer::keywordKind);
+    STATIC_CHECK(3u == lexing::TokenBuffer::opOrPunctuatorKind);
+    STATIC_CHECK(4u == lexing::TokenBuffer::identifierKind);
+}
+
+TEST_CASE(
+    "lexing::PackedToken stores a token in 8 bytes and restores it on demand.",
+    "[lexer]")
+{
+    STATIC_CHECK(8u == sizeof(lexing::PackedToken));
+
+    std::string const input = GENERATE(
+        "foo",
+        "const int&",
+        "std::vector<int, std::allocator<int>>::operator[]",
+        "void (__cdecl*)(int const volatile&&) noexcept");
+    CAPTURE(input);
+
+    lexing::Lexer lexer{input};
+    for (lexing::Token token = lexer.next();
+         !std::holds_alternative<lexing::token::End>(token.classification);
+         token = lexer.next())
+    {
+        lexing::PackedToken const packed = lexing::PackedToken::pack(token, input);
+
+        CHECK(token.content.data() - input.data() == packed.offset);
+        CHECK(token.content.size() == packed.length);
+        CHECK(token.classification.index() == packed.kind);
+        CHECK(token.content == packed.content(input));
+        CHECK(token.classification == packed.classification(input));
+        CHECK(is_same_token(token, packed.unpack(input)));
+    }
+}
+
+TEST_CASE(
+    "Lexer::tokenize_all stores the same tokens as subsequent Lexer::next calls.",
+    "[lexer]")
+{
+    std::string const input = GENERATE(
+        "",
+        "   ",
+        "foo",
+        "const int&",
+        "std::vector<int, std::allocator<int>>::operator[]",
+        "void (__cdecl*)(int const volatile&&) noexcept",
+        "`anonymous namespace'::{lambda()#1}::operator()");
+
+    std::vector<lexing::Token> expected{};
+    lexing::Lexer lexer{input};
+    do
+    {
+        expected.emplace_back(lexer.next());
+    }
+    while (!std::holds_alternative<lexing::token::End>(expected.back().classification));
+
+    lexing::TokenBuffer buffer{};
+    lexing::Lexer{input}.tokenize_all(buffer);
+
+    CHECK(input == buffer.source());
+    REQUIRE(expected.size() == buffer.size());
+    for (std::size_t i = 0u; i < expected.size(); ++i)
+    {
+        CHECK(is_same_token(expected[i], buffer[i]));
+        CHECK(expected[i].content == buffer.content(i));
+        CHECK(expected[i].classification.index() == buffer.kinds()[i]);
+    }
+}
+
+TEST_CASE(
+    "lexing::TokenBuffer can be reused.",
+    "[lexer]")
+{
+    lexing::TokenBuffer buffer{};
+
+    lexing::Lexer{"foo bar"}.tokenize_all(buffer);
+    REQUIRE(4u == buffer.size());
+
+    std::string_view constexpr other{"int"};
+    lexing::Lexer{other}.tokenize_all(buffer);
+    CHECK(other == buffer.source());
+    REQUIRE(2u == buffer.size());
+    CHECK(is_same_token(lexing::Token{.content = buffer.source(), .classification = lexing::token::Keyword{"int"}}, buffer[0u]));
+    CHECK(std::holds_alternative<lexing::token::End>(buffer[1u].classification));
+}
+
+TEST_CASE(
+    "lexing::TokenBuffer keeps the contents unpacked, when a token exceeds the limits of lexing::PackedToken.",
+    "[lexer]")
+{
+    std::string const name = "foo::" + std::string(lexing::PackedToken::maxLength + 1u, 'a') + "::bar";
+
+    lexing::TokenBuffer buffer{};
+    lexing::Lexer{std::string_view{name}}.tokenize_all(buffer);
+    CHECK(buffer.overflowed());
+    CHECK(0u == buffer.stable_prefix(name.size()));
+
+    lexing::Lexer lexer{std::string_view{name}};
+    REQUIRE(6u == buffer.size());
+    for (std::size_t i = 0u; i < buffer.size(); ++i)
+    {
+        lexing::Token const expected = lexer.next();
+        CHECK(expected.classification.index() == buffer.kinds()[i]);
+        CHECK(expected.content.data() == buffer.content(i).data());
+        CHECK(is_same_token(expected, buffer[i]));
+    }
+
+    CHECK(lexing::PackedToken::maxLength + 1u == buffer.content(2u).size());
+
+    SECTION("Resetting the buffer clears the mark.")
+    {
+        lexing::Lexer{std::string_view{name}.substr(0u, lexing::PackedToken::maxLength)}.tokenize_all(buffer);
+        CHECK(!buffer.overflowed());
+        CHECK(std::string_view{name}.substr(5u, lexing::PackedToken::maxLength - 5u) == buffer.content(2u));
+    }
+}
+
+TEST_CASE(
+    "Lexer::tokenize_remaining resumes lexing behind the stable tokens of a changed source.",
+    "[lexer]")
+{
+    auto const [previous, current] = GENERATE(
+        (table<std::string, std::string>)({
+            {        "foo::bar", "foo::baz"},
+            {        "foo::bar", "foo::bar_baz"},
+            {        "foo::bar", "foo:::bar"},
+            {"std::vector<int>", "std::vector<int>>"},
+            {        "foo<bar>", "foo<=bar>"},
+            {   "foo  bar::baz", "foo  bar::qux"},
+            {       "operator<", "operator<=>"},
+            {                "", "foo"},
+            {             "foo", ""}
+    }));
+    CAPTURE(previous, current);
+
+    std::string storage = previous;
+    storage.reserve(std::max(previous.size(), current.size()));
+
+    lexing::TokenBuffer buffer{};
+    lexing::Lexer{std::string_view{storage}}.tokenize_all(buffer);
+
+    std::size_t const sharedLength = static_cast<std::size_t>(
+        std::ranges::mismatch(previous, current).in1 - previous.cbegin());
+    std::size_t const count = buffer.stable_prefix(sharedLength);
+
+    storage = current;
+    std::string_view const source{storage};
+    buffer.reset(source, count);
+    std::size_t const offset = 0u < count ? buffer.offsets()[count - 1u] + std::size_t{buffer.lengths()[count - 1u]} : 0u;
+    lexing::Lexer{source.substr(offset)}.tokenize_remaining(buffer);
+
+    lexing::TokenBuffer expected{};
+    lexing::Lexer{source}.tokenize_all(expected);
+
+    REQUIRE(expected.size() == buffer.size());
+    for (std::size_t i = 0u; i < expected.size(); ++i)
+    {
+        CHECK(is_same_token(expected[i], buffer[i]));
+    }
+}
+
+TEST_CASE(
+    "lexing::TokenCursor iterates over the tokens of a TokenBuffer.",
+    "[lexer]")
+{
+    std::string_view constexpr input{"foo<int>"};
+    lexing::TokenBuffer buffer{};
+    lexing::Lexer{input}.tokenize_all(buffer);
+
+    lexing::TokenCursor cursor{buffer};
+    lexing::Lexer lexer{input};
+
+    for (std::size_t i = 0u; i < buffer.size(); ++i)
+    {
+        lexing::Token const expected = lexer.next();
+        CHECK(i == cursor.position());
+        CHECK(expected.classification.index() == cursor.kind());
+        CHECK(expected.content == cursor.content());
+
+        cursor.visit_next(
+            [&](std::string_view const content, auto const& tokenClass) {
+                CHECK(is_same_token(expected, lexing::Token{.content = content, .classification = tokenClass}));
+            });
+    }
+
+    SECTION("When the end is reached, the end-token is repeated.")
+    {
+        CHECK(lexing::TokenBuffer::endKind == cursor.kind());
+        cursor.advance();
+        CHECK(lexing::TokenBuffer::endKind == cursor.kind());
+        CHECK(buffer.size() - 1u == cursor.position());
+    }
+
+    SECTION("A cursor can be resumed at any position.")
+    {
+        for (std::size_t i = 0u; i < buffer.size(); ++i)
+        {
+            lexing::TokenCursor const resumed{buffer, i};
+            CHECK(i == resumed.position());
+            CHECK(buffer.kinds()[i] == resumed.kind());
+            CHECK(buffer.content(i) == resumed.content());
+        }
+    }
+}
+
+TEST_CASE(
+    "lexing::TokenCursor::peek_if returns the next token-class, when it's of the requested kind.",
+    "[lexer]")
+{
+    std::string_view constexpr input{"foo<int>"};
+    lexing::TokenBuffer buffer{};
+    lexing::Lexer{input}.tokenize_all(buffer);
+
+    lexing::TokenCursor cursor{buffer};
+    CHECK(!cursor.peek_if<lexing::token::Keyword>());
+    std::optional const identifier = cursor.peek_if<lexing::token::Identifier>();
+    REQUIRE(identifier);
+    CHECK(input.substr(0u, 3u) == identifier->content);
+    CHECK(input.data() == identifier->content.data());
+
+    cursor.advance();
+    CHECK(lexing::token::OperatorOrPunctuator{"<"} == cursor.peek_if<lexing::token::OperatorOrPunctuator>());
+
+    cursor.advance();
+    CHECK(lexing::token::Keyword{"int"} == cursor.peek_if<lexing::token::Keyword>());
+    CHECK(!cursor.peek_if<lexing::token::Identifier>());
+}
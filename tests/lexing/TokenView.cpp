@@ -0,0 +1,118 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/lexing/TokenView.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace ctnp;
+
+TEST_CASE(
+    "lexing::tokens yields the same tokens as Lexer::next.",
+    "[lexer]")
+{
+    std::string const input = GENERATE(
+        "",
+        " ",
+        "foo",
+        "const int&",
+        "std::vector<int, std::allocator<int>>::operator[]",
+        "void (__cdecl*)(int const volatile&&) noexcept");
+    CAPTURE(input);
+
+    std::vector<lexing::Token> expected{};
+    lexing::Lexer lexer{std::string_view{input}};
+    for (lexing::Token token = lexer.next();
+         !std::holds_alternative<lexing::token::End>(token.classification);
+         token = lexer.next())
+    {
+        expected.emplace_back(token);
+    }
+
+    SECTION("When constructed from std::string_view.")
+    {
+        std::vector<lexing::Token> tokens{};
+        std::ranges::copy(lexing::tokens(std::string_view{input}), std::back_inserter(tokens));
+
+        REQUIRE(expected.size() == tokens.size());
+        for (std::size_t i = 0u; i < expected.size(); ++i)
+        {
+            CHECK(expected[i].content == tokens[i].content);
+            CHECK(expected[i].classification == tokens[i].classification);
+        }
+    }
+
+    SECTION("When constructed from a NUL-terminated string.")
+    {
+        std::vector<lexing::Token> tokens{};
+        std::ranges::copy(lexing::tokens(input.c_str()), std::back_inserter(tokens));
+
+        REQUIRE(expected.size() == tokens.size());
+        for (std::size_t i = 0u; i < expected.size(); ++i)
+        {
+            CHECK(expected[i].content == tokens[i].content);
+            CHECK(expected[i].classification == tokens[i].classification);
+        }
+    }
+}
+
+TEST_CASE(
+    "lexing::tokens composes with range adaptors.",
+    "[lexer]")
+{
+    constexpr std::string_view input{"std::vector<int> const& foo::operator()(int)"};
+
+    SECTION("Tokens can be filtered.")
+    {
+        auto identifiers = lexing::tokens(input)
+                         | std::views::filter([](lexing::Token const& token) {
+                               return std::holds_alternative<lexing::token::Identifier>(token.classification);
+                           })
+                         | std::views::transform(&lexing::Token::content);
+
+        std::vector<std::string_view> result{};
+        std::ranges::copy(identifiers, std::back_inserter(result));
+        CHECK(std::vector<std::string_view>{"std", "vector", "foo"} == result);
+    }
+
+    SECTION("Iteration can be stopped early.")
+    {
+        auto firstScope = lexing::tokens(input)
+                        | std::views::take_while([](lexing::Token const& token) {
+                              return lexing::token::TokenClass{lexing::token::OperatorOrPunctuator{"::"}} != token.classification;
+                          });
+
+        CHECK(1 == std::ranges::distance(firstScope));
+        CHECK("std" == (*firstScope.begin()).content);
+    }
+
+    SECTION("Presence of a keyword can be determined.")
+    {
+        STATIC_CHECK(
+            std::ranges::any_of(
+                lexing::tokens(input),
+                [](lexing::Token const& token) {
+                    return lexing::token::TokenClass{lexing::token::Keyword{"operator"}} == token.classification;
+                }));
+    }
+}
+
+TEST_CASE(
+    "lexing::TokenView is a borrowed range.",
+    "[lexer]")
+{
+    constexpr std::string_view input{"foo bar"};
+
+    // The view is a temporary, but the iterator remains valid.
+    auto const iter = std::ranges::find_if(
+        lexing::tokens(input),
+        [](lexing::Token const& token) { return "bar" == token.content; });
+
+    CHECK(input.substr(4u) == (*iter).content);
+}
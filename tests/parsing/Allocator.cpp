@@ -0,0 +1,91 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/parsing/Allocator.hpp"
+
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+using namespace ctnp;
+
+namespace
+{
+    using IntSequence = std::vector<int, parsing::Allocator<int>>;
+}
+
+TEST_CASE(
+    "parsing::Allocator draws from the active resource, when default constructed.",
+    "[parsing]")
+{
+    CHECK(std::pmr::new_delete_resource() == parsing::Allocator<int>{}.resource());
+
+    std::pmr::monotonic_buffer_resource outer{};
+    std::pmr::monotonic_buffer_resource inner{};
+    {
+        parsing::detail::ResourceScope const outerScope{outer};
+        CHECK(&outer == parsing::Allocator<int>{}.resource());
+
+        {
+            parsing::detail::ResourceScope const innerScope{inner};
+            CHECK(&inner == parsing::Allocator<int>{}.resource());
+        }
+
+        CHECK(&outer == parsing::Allocator<int>{}.resource());
+    }
+
+    CHECK(std::pmr::new_delete_resource() == parsing::Allocator<int>{}.resource());
+}
+
+TEST_CASE(
+    "Copies of containers with parsing::Allocator keep the resource of their source.",
+    "[parsing]")
+{
+    std::pmr::monotonic_buffer_resource resource{};
+    std::optional<IntSequence> source{};
+    {
+        parsing::detail::ResourceScope const scope{resource};
+        source.emplace(IntSequence{1, 2, 3});
+    }
+    REQUIRE(&resource == source->get_allocator().resource());
+
+    SECTION("When copied outside of any scope.")
+    {
+        IntSequence const copy{*source};
+
+        CHECK(*source == copy);
+        CHECK(&resource == copy.get_allocator().resource());
+    }
+
+    SECTION("When copied inside a nested scope.")
+    {
+        std::pmr::monotonic_buffer_resource other{};
+        parsing::detail::ResourceScope const scope{other};
+        IntSequence const copy{*source};
+
+        CHECK(*source == copy);
+        CHECK(&resource == copy.get_allocator().resource());
+    }
+}
+
+TEST_CASE(
+    "Copies of containers with parsing::Allocator may outlive the scope they are made in.",
+    "[parsing]")
+{
+    IntSequence const source{1, 2, 3};
+    REQUIRE(std::pmr::new_delete_resource() == source.get_allocator().resource());
+
+    std::optional<IntSequence> copy{};
+    {
+        // Any allocation from this resource fails, thus the copy must not draw from it.
+        std::pmr::monotonic_buffer_resource resource{std::pmr::null_memory_resource()};
+        parsing::detail::ResourceScope const scope{resource};
+        copy.emplace(source);
+    }
+
+    REQUIRE(copy);
+    CHECK(source == *copy);
+    CHECK(std::pmr::new_delete_resource() == copy->get_allocator().resource());
+}
@@ -0,0 +1,107 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/parsing/Box.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+using namespace ctnp;
+
+TEST_CASE(
+    "parsing::Box is empty by default.",
+    "[parsing]")
+{
+    parsing::Box<std::string> const box{};
+
+    CHECK(!box);
+    CHECK(nullptr == box.get());
+}
+
+TEST_CASE(
+    "parsing::Box::make creates a non-empty box.",
+    "[parsing]")
+{
+    parsing::Box<std::string> const box = parsing::Box<std::string>::make("Hello, World!");
+
+    REQUIRE(box);
+    CHECK("Hello, World!" == *box);
+    CHECK(13u == box->size());
+}
+
+TEST_CASE(
+    "parsing::Box has value-semantics.",
+    "[parsing]")
+{
+    parsing::Box<std::string> box = parsing::Box<std::string>::make("Hello, World!");
+    std::string const* const value = box.get();
+
+    SECTION("When copied, the value is copied.")
+    {
+        parsing::Box<std::string> const copy{box};
+
+        REQUIRE(copy);
+        CHECK(value != copy.get());
+        CHECK(*box == *copy);
+    }
+
+    SECTION("When an empty box is copied, the copy is empty, too.")
+    {
+        parsing::Box<std::string> const empty{};
+        parsing::Box<std::string> const copy{empty};
+
+        CHECK(!copy);
+    }
+
+    SECTION("When moved, the ownership is transferred.")
+    {
+        parsing::Box<std::string> const other{std::move(box)};
+
+        CHECK(value == other.get());
+        CHECK(!box); // NOLINT(*-use-after-move)
+    }
+
+    SECTION("When reset, the box becomes empty.")
+    {
+        box.reset();
+
+        CHECK(!box);
+    }
+}
+
+TEST_CASE(
+    "parsing::Box allocates from the active resource.",
+    "[parsing]")
+{
+    alignas(int) std::byte buffer[64];
+    std::pmr::monotonic_buffer_resource resource{buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+    auto const is_in_buffer = [&](int const* const ptr) {
+        auto const* const address = reinterpret_cast<std::byte const*>(ptr);
+        return std::less_equal{}(buffer, address) && std::less{}(address, buffer + sizeof(buffer));
+    };
+
+    parsing::Box<int> box{};
+    {
+        parsing::detail::ResourceScope const scope{resource};
+        box = parsing::Box<int>::make(42);
+    }
+
+    REQUIRE(box);
+    CHECK(42 == *box);
+    CHECK(is_in_buffer(box.get()));
+
+    SECTION("Copies allocate from the resource of the source.")
+    {
+        parsing::Box<int> const copy{box};
+
+        REQUIRE(copy);
+        CHECK(42 == *copy);
+        CHECK(copy.get() != box.get());
+        CHECK(is_in_buffer(copy.get()));
+    }
+}
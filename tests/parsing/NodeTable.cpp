@@ -0,0 +1,97 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/parsing/NodeTable.hpp"
+#include "ctnp/PrintVisitor.hpp"
+#include "ctnp/parsing/Parser.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace ctnp;
+
+TEST_CASE(
+    "parsing::NodeTable stores the parse-result in pre-order.",
+    "[parsing]")
+{
+    parsing::detail::ParserImpl parser{"int const"};
+    parsing::NodeTable const& table = parser.parse_type_table();
+
+    std::vector<parsing::Node::Kind> kinds{};
+    std::ranges::transform(table.nodes(), std::back_inserter(kinds), &parsing::Node::kind);
+    CHECK_THAT(
+        kinds,
+        Catch::Matchers::RangeEquals(
+            std::vector<parsing::Node::Kind>{
+                parsing::Node::begin,
+                parsing::Node::beginType,
+                parsing::Node::identifier,
+                parsing::Node::constSpec,
+                parsing::Node::endType,
+                parsing::Node::end}));
+
+    SECTION("Each node knows the extent of its subtree.")
+    {
+        CHECK(6u == table[0u].extent);
+        CHECK(5u == table[1u].extent);
+        CHECK(3u == table[2u].extent);
+        CHECK(4u == table[3u].extent);
+        CHECK(5u == table[4u].extent);
+        CHECK(6u == table[5u].extent);
+    }
+
+    SECTION("Identifiers carry their content and flags.")
+    {
+        CHECK("int" == table[2u].content);
+        CHECK(0u != (table[2u].flags & lexing::token::Identifier::builtin));
+    }
+}
+
+TEST_CASE(
+    "parsing::NodeTable records unrecognized content.",
+    "[parsing]")
+{
+    parsing::detail::ParserImpl parser{"(int"};
+    parsing::NodeTable const& table = parser.parse_type_table();
+
+    REQUIRE(1u == table.size());
+    CHECK(parsing::Node::unrecognized == table[0u].kind);
+    CHECK("(int" == table[0u].content);
+}
+
+TEST_CASE(
+    "Replaying a parsing::NodeTable is equivalent to visiting the parse-result.",
+    "[parsing]")
+{
+    std::string const name = GENERATE(
+        "int",
+        "const volatile int* const&",
+        "std::vector<int, std::allocator<int>>",
+        "std::map<std::basic_string<char, std::char_traits<char>>, std::vector<std::pair<int, float>>>",
+        "void (__cdecl*)(int const volatile&&) noexcept",
+        "std::basic_string<char>::operator std::basic_string_view<char>() const",
+        "`anonymous namespace'::{lambda()#1}::operator()(int) const",
+        "void foo<int (*)(float)>(int&&, char const*) &&");
+    CAPTURE(name);
+
+    std::string expected{};
+    {
+        parsing::detail::ParserImpl parser{name};
+        PrintVisitor visitor{std::back_inserter(expected)};
+        std::visit(
+            parsing::detail::ResultVisitor<decltype(visitor)>{.visitor = visitor, .content = name},
+            parser.parse_function());
+    }
+
+    parsing::detail::ParserImpl parser{name};
+    parsing::NodeTable const table = parser.parse_function_table();
+
+    std::string replayed{};
+    PrintVisitor visitor{std::back_inserter(replayed)};
+    table.replay(visitor);
+    CHECK(expected == replayed);
+}
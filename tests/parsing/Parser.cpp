@@ -4,6 +4,15 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 
 #include "ctnp/parsing/Parser.hpp"
+#include "ctnp/PrintVisitor.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
 using namespace ctnp;
 
@@ -2617,3 +2626,181 @@ TEST_CASE(
         parser.parse_function();
     }
 }
+
+TEST_CASE(
+    "parsing::NameParser skips template-args, when requested.",
+    "[parsing]")
+{
+    auto const [name, expectedCount] = GENERATE(
+        (table<std::string_view, std::uint32_t>)({
+            {                                      "foo<>", 0u},
+            {                                     "foo< >", 0u},
+            {                           "std::vector<int>", 1u},
+            {          "foo<bar<int, float>, std::size_t>", 2u},
+            {       "foo<void (*)(int, float), bar<int>&>", 2u},
+            {        "foo<ns::bar<int>::baz, int const*>", 2u}
+    }));
+    CAPTURE(name);
+
+    parsing::detail::ParserImpl parser{name};
+    parser.skip_template_args(true);
+    parsing::NodeTable const& table = parser.parse_type_table();
+
+    auto const iter = std::ranges::find(table.nodes(), parsing::Node::beginTemplateArgs, &parsing::Node::kind);
+    REQUIRE(iter != table.nodes().end());
+    CHECK(expectedCount == iter->count);
+    REQUIRE(std::next(iter) != table.nodes().end());
+    CHECK(parsing::Node::endTemplateArgs == std::next(iter)->kind);
+}
+
+TEST_CASE(
+    "parsing::NameParser parses template-args as usual, when they can not be skipped safely.",
+    "[parsing]")
+{
+    std::string const name = GENERATE(
+        "foo<void(int)>",
+        "foo<bar::operator<>",
+        "foo<bar>>",
+        "foo<(int>");
+    CAPTURE(name);
+
+    parsing::detail::ParserImpl expectedParser{name};
+    parsing::NodeTable const& expected = expectedParser.parse_type_table();
+
+    parsing::detail::ParserImpl parser{name};
+    parser.skip_template_args(true);
+    parsing::NodeTable const& actual = parser.parse_type_table();
+
+    CHECK(std::ranges::equal(expected.nodes(), actual.nodes(), {}, &parsing::Node::kind, &parsing::Node::kind));
+}
+
+TEST_CASE(
+    "parsing::Parser prints the same, whether the visitor discards template-args or not.",
+    "[parsing]")
+{
+    std::string const name = GENERATE(
+        "foo<int[3]>",
+        "foo<&bar>",
+        "foo<(bar)>",
+        "foo<(char)1>",
+        "foo<int (&)(int)>",
+        "foo<int (C*)(int)>",
+        "foo<int*(*)(int)>",
+        "foo<int (*) (int)>",
+        "foo<(anonymous namespace)::bar>",
+        "foo<const class bar>",
+        "foo<unsigned  int>",
+        "foo<bar ::baz>",
+        "foo<bar<int>__ptr64>",
+        "foo<<>, bar>",
+        "foo<int (*)(int), bar<int> const&>",
+        "foo<unsigned long __ptr64>::bar");
+    CAPTURE(name);
+
+    SECTION("When parsing types.")
+    {
+        std::string expected{};
+        PrintVisitor visitor{std::back_inserter(expected)};
+        parsing::detail::ParserImpl expectedParser{name};
+        expectedParser.parse_type_table().replay(visitor);
+
+        std::string actual{};
+        parsing::Parser{PrintVisitor{std::back_inserter(actual)}, name}.parse_type();
+
+        CHECK(expected == actual);
+    }
+
+    SECTION("When parsing functions.")
+    {
+        std::string expected{};
+        PrintVisitor visitor{std::back_inserter(expected)};
+        parsing::detail::ParserImpl expectedParser{name};
+        expectedParser.parse_function_table().replay(visitor);
+
+        std::string actual{};
+        parsing::Parser{PrintVisitor{std::back_inserter(actual)}, name}.parse_function();
+
+        CHECK(expected == actual);
+    }
+}
+
+TEST_CASE(
+    "parsing::BatchParser yields the same results as independent parses.",
+    "[parsing]")
+{
+    std::vector<std::string> const names{
+        "void mylib::detail::engine<int, std::vector<float>>::run(int) const",
+        "void mylib::detail::engine<int, std::vector<float>>::stop()",
+        "void mylib::detail::engine<int, std::vector<float>>::stop()",
+        "void mylib::detail::engine<int, std::vector<float>>::stop_all()",
+        "void mylib::detail::engine<int, std::vector<float>>::worker::step() &&",
+        "void mylib::detail::engine<int, std::vector<float>>::worker_pool<(anonymous namespace)::task>::step()",
+        "mylib::detail::engine<int, std::vector<float>>",
+        "mylib::detail::engine<int, std::vector<float>>::value_type const&",
+        "void mylib::detail::engine<int, std::vector<double>>::run(int) const",
+        "void mylib::detail_v2::engine<int>::run(int) const",
+        "void mylib::detail::engine<int, std::vector<float>>::operator()(int) const",
+        "mylib::detail::engine<int, std::vector<float>>::operator bool() const",
+        "mylib::detail::engine<int, std::vector<float>>::operator<<(int)",
+        "void mylib::detail::engine<int, std::vector<float>>::run(int) const",
+        "void mylib::(int",
+        "void mylib::detail::engine<int, std::vector<float>>::run(int) const",
+        "int"};
+
+    auto const projection = [](parsing::Node const& node) {
+        return std::tuple{node.kind, node.content, node.count, node.flags};
+    };
+
+    parsing::BatchParser batch{};
+
+    SECTION("When parsing functions.")
+    {
+        for (std::string const& name : names)
+        {
+            CAPTURE(name);
+
+            parsing::detail::ParserImpl expectedParser{name};
+            parsing::NodeTable const& expected = expectedParser.parse_function_table();
+
+            parsing::NodeTable actual{};
+            parsing::detail::NodeRecorder recorder{actual};
+            batch.parse_function(name, recorder);
+
+            CHECK(std::ranges::equal(expected.nodes(), actual.nodes(), {}, projection, projection));
+        }
+    }
+
+    SECTION("When parsing types.")
+    {
+        for (std::string const& name : names)
+        {
+            CAPTURE(name);
+
+            parsing::detail::ParserImpl expectedParser{name};
+            parsing::NodeTable const& expected = expectedParser.parse_type_table();
+
+            parsing::NodeTable actual{};
+            parsing::detail::NodeRecorder recorder{actual};
+            batch.parse_type(name, recorder);
+
+            CHECK(std::ranges::equal(expected.nodes(), actual.nodes(), {}, projection, projection));
+        }
+    }
+
+    SECTION("When template-args are skipped.")
+    {
+        for (std::string const& name : names)
+        {
+            CAPTURE(name);
+
+            std::string expected{};
+            parsing::NameKind const expectedKind =
+                parsing::Parser{PrintVisitor{std::back_inserter(expected)}, name}.parse_auto();
+
+            std::string actual{};
+            PrintVisitor visitor{std::back_inserter(actual)};
+            CHECK(expectedKind == batch.parse_auto(name, visitor));
+            CHECK(expected == actual);
+        }
+    }
+}
@@ -3,4 +3,50 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-#include "ctnp/parsing/Reductions.hpp"
\ No newline at end of file
+#include "ctnp/parsing/Reductions.hpp"
+
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+using namespace ctnp;
+
+TEST_CASE(
+    "parsing::is_suffix_of and parsing::match_suffix inspect the top of the token-stack.",
+    "[parsing]")
+{
+    parsing::TokenStack stack{};
+
+    CHECK(!parsing::is_suffix_of<parsing::token::Space>(stack));
+    CHECK(!parsing::match_suffix<parsing::token::Space>(stack));
+
+    stack.emplace_back(parsing::token::Space{});
+    stack.emplace_back(std::in_place_type<parsing::token::ArgSeparator>, ",");
+    stack.emplace_back(parsing::token::Identifier{.content = "foo"});
+
+    CHECK(parsing::is_suffix_of<parsing::token::Identifier>(stack));
+    CHECK(parsing::is_suffix_of<parsing::token::ArgSeparator, parsing::token::Identifier>(stack));
+    CHECK(parsing::is_suffix_of<parsing::token::Space, parsing::token::ArgSeparator, parsing::token::Identifier>(stack));
+    CHECK(!parsing::is_suffix_of<parsing::token::Space>(stack));
+    CHECK(!parsing::is_suffix_of<parsing::token::Space, parsing::token::Identifier>(stack));
+    CHECK(!parsing::is_suffix_of<parsing::token::Space, parsing::token::Space, parsing::token::ArgSeparator, parsing::token::Identifier>(stack));
+
+    auto* const identifier = parsing::match_suffix<parsing::token::Identifier>(stack);
+    REQUIRE(identifier);
+    CHECK(&std::get<parsing::token::Identifier>(stack.back()) == identifier);
+
+    std::optional const suffix = parsing::match_suffix<parsing::token::ArgSeparator, parsing::token::Identifier>(stack);
+    REQUIRE(suffix);
+    CHECK("," == std::get<0>(*suffix).content);
+    CHECK(identifier == &std::get<1>(*suffix));
+
+    SECTION("Views just consider their viewed part.")
+    {
+        parsing::TokenStackView view{stack};
+        parsing::remove_suffix(view, 1u);
+
+        CHECK(parsing::is_suffix_of<parsing::token::Space, parsing::token::ArgSeparator>(view));
+        CHECK(!parsing::is_suffix_of<parsing::token::Identifier>(view));
+    }
+}
@@ -3,4 +3,188 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-#include "ctnp/parsing/Tokens.hpp"
\ No newline at end of file
+#include "ctnp/parsing/Tokens.hpp"
+#include "ctnp/parsing/NodeTable.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace ctnp;
+
+TEST_CASE(
+    "parsing::token::Specs has a single unqualified layer by default.",
+    "[parsing]")
+{
+    parsing::token::Specs const specs{};
+
+    CHECK(1u == specs.layer_count());
+    CHECK(!specs.has_ptr());
+    CHECK(!specs.top().isConst);
+    CHECK(!specs.top().isVolatile);
+}
+
+TEST_CASE(
+    "parsing::token::Specs qualifies the innermost layer.",
+    "[parsing]")
+{
+    std::size_t const depth = GENERATE(
+        0u,
+        1u,
+        parsing::token::Specs::inlineLayers - 1u,
+        parsing::token::Specs::inlineLayers,
+        parsing::token::Specs::inlineLayers + 5u);
+    CAPTURE(depth);
+
+    // Each layer `i` is const, if `i % 2 == 0` and volatile, if `i % 3 == 0`.
+    parsing::token::Specs specs{};
+    for (std::size_t i = 0u; i <= depth; ++i)
+    {
+        if (0u != i)
+        {
+            specs.add_ptr();
+        }
+
+        if (0u == i % 2u)
+        {
+            specs.add_const();
+        }
+
+        if (0u == i % 3u)
+        {
+            specs.add_volatile();
+        }
+    }
+
+    REQUIRE(depth + 1u == specs.layer_count());
+    CHECK((0u < depth) == specs.has_ptr());
+    for (std::size_t i = 0u; i <= depth; ++i)
+    {
+        CAPTURE(i);
+        CHECK((0u == i % 2u) == specs.layer(i).isConst);
+        CHECK((0u == i % 3u) == specs.layer(i).isVolatile);
+    }
+
+    SECTION("And emits each layer in order.")
+    {
+        std::vector<parsing::Node::Kind> expected{};
+        for (std::size_t i = 0u; i <= depth; ++i)
+        {
+            if (0u != i)
+            {
+                expected.emplace_back(parsing::Node::ptr);
+            }
+
+            if (0u == i % 2u)
+            {
+                expected.emplace_back(parsing::Node::constSpec);
+            }
+
+            if (0u == i % 3u)
+            {
+                expected.emplace_back(parsing::Node::volatileSpec);
+            }
+        }
+
+        parsing::NodeTable table{};
+        parsing::detail::NodeRecorder recorder{table};
+        specs(recorder);
+
+        std::vector<parsing::Node::Kind> kinds{};
+        for (parsing::Node const& node : table.nodes())
+        {
+            kinds.emplace_back(node.kind);
+        }
+        CHECK_THAT(
+            kinds,
+            Catch::Matchers::RangeEquals(expected));
+    }
+}
+
+TEST_CASE(
+    "parsing::TokenStack maintains the kind of each token.",
+    "[parsing]")
+{
+    parsing::TokenStack stack{};
+    stack.emplace_back(parsing::token::Space{});
+    stack.emplace_back(parsing::token::Specs{});
+    stack.emplace_back(std::in_place_type<parsing::token::ArgSeparator>, ",");
+    stack.emplace_back(parsing::token::Identifier{.content = "foo"});
+
+    auto const check_kinds = [&] {
+        REQUIRE(stack.size() == stack.kinds().size());
+        for (std::size_t i = 0u; i < stack.size(); ++i)
+        {
+            CHECK(stack.data()[i].index() == stack.kinds()[i]);
+        }
+    };
+
+    check_kinds();
+
+    SECTION("When popping a token.")
+    {
+        stack.pop_back();
+        CHECK(3u == stack.size());
+        check_kinds();
+    }
+
+    SECTION("When truncating the stack.")
+    {
+        stack.truncate(1u);
+        CHECK(1u == stack.size());
+        check_kinds();
+    }
+
+    SECTION("When erasing a token.")
+    {
+        stack.erase(stack.cbegin() + 1);
+        CHECK(3u == stack.size());
+        check_kinds();
+    }
+
+    SECTION("When clearing the stack.")
+    {
+        stack.clear();
+        CHECK(stack.empty());
+        check_kinds();
+    }
+}
+
+TEST_CASE(
+    "parsing::TokenStack tracks the positions of brackets.",
+    "[parsing]")
+{
+    using parsing::token::OpeningAngle;
+    using parsing::token::OpeningParens;
+
+    parsing::TokenStack stack{};
+    CHECK(!stack.find_last_bracket<OpeningAngle>(stack.size()));
+
+    stack.emplace_back(parsing::token::Identifier{.content = "foo"});
+    stack.emplace_back(std::in_place_type<OpeningAngle>, "<");
+    stack.emplace_back(std::in_place_type<OpeningParens>, "(");
+    stack.emplace_back(std::in_place_type<OpeningAngle>, "<");
+
+    CHECK(std::optional<std::size_t>{3u} == stack.find_last_bracket<OpeningAngle>(stack.size()));
+    CHECK(std::optional<std::size_t>{1u} == stack.find_last_bracket<OpeningAngle>(3u));
+    CHECK(!stack.find_last_bracket<OpeningAngle>(1u));
+    CHECK(std::optional<std::size_t>{2u} == stack.find_last_bracket<OpeningParens>(stack.size()));
+
+    SECTION("When tokens are removed from the top.")
+    {
+        stack.truncate(2u);
+
+        CHECK(std::optional<std::size_t>{1u} == stack.find_last_bracket<OpeningAngle>(stack.size()));
+        CHECK(!stack.find_last_bracket<OpeningParens>(stack.size()));
+    }
+
+    SECTION("When a token is erased in between.")
+    {
+        stack.erase(stack.cbegin() + 1);
+
+        CHECK(std::optional<std::size_t>{2u} == stack.find_last_bracket<OpeningAngle>(stack.size()));
+        CHECK(!stack.find_last_bracket<OpeningAngle>(2u));
+        CHECK(std::optional<std::size_t>{1u} == stack.find_last_bracket<OpeningParens>(stack.size()));
+    }
+}
@@ -0,0 +1,139 @@
+//          Copyright Dominic (DNKpp) Koepke 2025 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ctnp/parsing/Traversal.hpp"
+#include "ctnp/parsing/NodeTable.hpp"
+#include "ctnp/parsing/Parser.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace ctnp;
+
+namespace
+{
+    [[nodiscard]]
+    bool is_same_node(parsing::Node const& lhs, parsing::Node const& rhs)
+    {
+        return lhs.kind == rhs.kind
+            && lhs.content == rhs.content
+            && lhs.count == rhs.count
+            && lhs.flags == rhs.flags
+            && lhs.extent == rhs.extent;
+    }
+}
+
+TEST_CASE(
+    "parsing::Traversal emits the same callbacks as the recursive visitation.",
+    "[parsing]")
+{
+    std::string const name = GENERATE(
+        "int",
+        "const volatile int* const&",
+        "std::vector<int, std::allocator<int>>",
+        "void (__cdecl*)(int const volatile&&) noexcept",
+        "void (*(*)(int))(float)",
+        "std::basic_string<char>::operator std::basic_string_view<char>() const",
+        "`anonymous namespace'::{lambda()#1}::operator()(int) const",
+        "bool foo::bar(int)::my_type<int>::operator<(int) const",
+        "void foo<int (*)(float)>(int&&, char const*) &&");
+    CAPTURE(name);
+
+    parsing::detail::ParserImpl parser{name};
+    parsing::detail::FunctionResult const result = parser.parse_function();
+    REQUIRE(!std::holds_alternative<std::monostate>(result));
+
+    parsing::NodeTable expected{};
+    {
+        parsing::detail::NodeRecorder recorder{expected};
+        std::visit(
+            [&](auto const& inner) {
+                if constexpr (std::invocable<decltype(inner), parsing::detail::NodeRecorder&>)
+                {
+                    std::invoke(inner, recorder);
+                }
+            },
+            result);
+    }
+
+    parsing::NodeTable actual{};
+    {
+        parsing::detail::NodeRecorder recorder{actual};
+        parsing::Traversal traversal{};
+        std::visit(
+            [&](auto const& inner) {
+                if constexpr (std::invocable<decltype(inner), parsing::detail::NodeRecorder&>)
+                {
+                    traversal(inner, recorder);
+                }
+            },
+            result);
+    }
+
+    CHECK(!expected.empty());
+    CHECK(std::ranges::equal(expected.nodes(), actual.nodes(), &is_same_node));
+}
+
+TEST_CASE(
+    "parsing::Traversal handles deeply nested names.",
+    "[parsing]")
+{
+    constexpr std::size_t depth{1000u};
+
+    std::string name{};
+    for (std::size_t i = 0u; i < depth; ++i)
+    {
+        name += "foo<";
+    }
+    name += "int";
+    name.append(depth, '>');
+
+    parsing::detail::ParserImpl parser{name};
+    parsing::NodeTable const& table = parser.parse_type_table();
+
+    REQUIRE(!table.empty());
+    CHECK(parsing::Node::begin == table[0u].kind);
+    CHECK(table.size() == table[0u].extent);
+    CHECK(depth == std::ranges::count(table.nodes(), parsing::Node::beginTemplateArgs, &parsing::Node::kind));
+}
+
+TEST_CASE(
+    "parsing::Traversal splices flushed args.",
+    "[parsing]")
+{
+    std::vector<parsing::Node> const flushed{
+        parsing::Node{.kind = parsing::Node::identifier},
+        parsing::Node{.kind = parsing::Node::beginType},
+        parsing::Node{.content = "int", .kind = parsing::Node::identifier},
+        parsing::Node{.kind = parsing::Node::endType},
+        parsing::Node{.kind = parsing::Node::identifier}};
+
+    parsing::token::ArgSequence args{};
+    args.flushed = parsing::token::ArgSequence::Flushed{.offset = 1u, .size = 3u, .count = 1u};
+    CHECK(1u == args.count());
+
+    parsing::NodeTable table{};
+    {
+        parsing::detail::NodeRecorder recorder{table};
+        parsing::Traversal traversal{};
+        traversal(args, recorder, flushed);
+    }
+
+    std::vector<parsing::Node::Kind> kinds{};
+    std::ranges::transform(table.nodes(), std::back_inserter(kinds), &parsing::Node::kind);
+    CHECK_THAT(
+        kinds,
+        Catch::Matchers::RangeEquals(
+            std::vector<parsing::Node::Kind>{
+                parsing::Node::beginType,
+                parsing::Node::identifier,
+                parsing::Node::endType}));
+    CHECK("int" == table[1u].content);
+}